@@ -0,0 +1,2206 @@
+#line 44 "core.org"
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "graforge.h"
+#define SK_CORE_PRIV
+#include "core.h"
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#line 1893 "core.org"
+static void pqueue_apply(sk_core *core, int len);
+#line 1993 "core.org"
+static void evqueue_clean(sk_evqueue *q);
+#line 2065 "core.org"
+static int evqueue_fire(sk_core *core, int len);
+#line 2986 "core.org"
+static void swap_pickup(sk_swap *swap);
+#line 3694 "core.org"
+static int hash(const char *str, int sz, int mod);
+#line 44 "core.org"
+#line 576 "core.org"
+enum {
+   SK_TYPE_NONE,
+   SK_TYPE_CONSTANT,
+   SK_TYPE_CABLE,
+   SK_TYPE_TABLE,
+   SK_TYPE_GENERIC,
+   SK_TYPE_LIVE,
+   SK_TYPE_POLY,
+   SK_TYPE_SWAP
+};
+#line 44 "core.org"
+#line 76 "core.org"
+sk_core * sk_core_new(int sr, int blksize)
+{
+    sk_core *core;
+    gf_patch *patch;
+
+    core = malloc(sizeof(sk_core));
+    core->patch = malloc(gf_patch_size());
+
+    if (blksize <= 0) blksize = 64;
+
+    patch = core->patch;
+    gf_patch_init(patch, blksize);
+    gf_patch_alloc(patch, 8, 10);
+    gf_patch_srate_set(patch, sr);
+
+    sk_stack_init(&core->stack);
+    sk_regtbl_init(&core->regtbl);
+    sk_dict_init(&core->dict);
+    sk_pqueue_init(&core->pq);
+    sk_evqueue_init(&core->evq);
+    core->time = 0;
+    core->poly = NULL;
+
+    sk_core_srand(core, 0);
+    return core;
+}
+#line 106 "core.org"
+void sk_core_del(sk_core *core)
+{
+    if (core == NULL) return;
+
+    evqueue_clean(&core->evq);
+    gf_patch_destroy(core->patch);
+    gf_patch_free_nodes(core->patch);
+    free(core->patch);
+    sk_dict_clean(&core->dict);
+    free(core);
+    core = NULL;
+}
+#line 157 "core.org"
+void sk_core_compute(sk_core *core)
+{
+    int blksize;
+    int pos;
+    int len;
+
+    blksize = gf_patch_blksize(core->patch);
+    pos = 0;
+
+    while (pos < blksize) {
+        len = evqueue_fire(core, blksize - pos);
+        pqueue_apply(core, len);
+        gf_patch_compute_sub(core->patch, pos, len);
+        core->time += len;
+        pos += len;
+    }
+}
+#line 188 "core.org"
+size_t sk_core_computes(sk_core *core, SKFLT secs)
+{
+    size_t nblocks, n;
+    nblocks = sk_core_seconds_to_blocks(core, secs);
+
+    for (n = 0; n < nblocks; n++) {
+        sk_core_compute(core);
+    }
+
+    return nblocks;
+}
+#line 212 "core.org"
+gf_patch * sk_core_patch(sk_core *core)
+{
+    return core->patch;
+}
+#line 228 "core.org"
+size_t sk_core_seconds_to_blocks(sk_core *core, SKFLT secs)
+{
+    size_t nblocks;
+    int sr;
+
+    sr = gf_patch_srate_get(core->patch);
+    nblocks = floor((sr * secs) / gf_patch_blksize(core->patch)) + 1;
+
+    return nblocks;
+}
+#line 254 "core.org"
+int sk_core_blkset(sk_core *core, int sz)
+{
+    return gf_patch_blksize_set(core->patch, sz);
+}
+#line 272 "core.org"
+int sk_core_blkmax(sk_core *core, int sz)
+{
+    return gf_patch_maxblksize_set(core->patch, sz);
+}
+#line 291 "core.org"
+void sk_core_klerp(sk_core *core, int klerp)
+{
+    gf_patch_klerp_set(core->patch, klerp);
+}
+#line 317 "core.org"
+int sk_core_threads(sk_core *core, int nthreads)
+{
+    return gf_patch_threads(core->patch, nthreads) != GF_OK;
+}
+#line 338 "core.org"
+int sk_core_optimize(sk_core *core)
+{
+    return gf_patch_optimize(core->patch) != GF_OK;
+}
+#line 365 "core.org"
+int sk_core_arena(sk_core *core, unsigned long size)
+{
+    return gf_patch_arena(core->patch, size) != GF_OK;
+}
+#line 396 "core.org"
+int sk_core_profile(sk_core *core, int on)
+{
+    return gf_patch_profile(core->patch, on) != GF_OK;
+}
+
+void sk_core_tag(sk_core *core, const char *tag)
+{
+    gf_patch_tag(core->patch, tag);
+}
+
+int sk_core_profdump(sk_core *core, const char *filename)
+{
+    FILE *fp;
+    int rc;
+
+    fp = stdout;
+
+    if (filename != NULL) {
+        fp = fopen(filename, "w");
+        if (fp == NULL) return 1;
+    }
+
+    rc = gf_patch_profdump(core->patch, fp);
+
+    if (fp != stdout) fclose(fp);
+
+    return rc != GF_OK;
+}
+#line 433 "core.org"
+sk_stack* sk_core_stack(sk_core *core)
+{
+    return &core->stack;
+}
+#line 446 "core.org"
+sk_dict* sk_core_dict(sk_core *core)
+{
+    return &core->dict;
+}
+#line 461 "core.org"
+void sk_core_srate_set(sk_core *core, int sr)
+{
+    gf_patch_srate_set(core->patch, sr);
+}
+#line 498 "core.org"
+void sk_stacklet_init(sk_stacklet *s)
+{
+    s->type = SK_TYPE_NONE;
+    s->f = 0;
+    s->ptr = NULL;
+}
+#line 514 "core.org"
+SKFLT sk_stacklet_constant(sk_stacklet *s)
+{
+    return s->f;
+}
+#line 522 "core.org"
+void * sk_stacklet_userdata(sk_stacklet *s)
+{
+    return s->ptr;
+}
+#line 560 "core.org"
+void sk_stack_init(sk_stack *s)
+{
+    int i;
+
+    for (i = 0; i < SK_STACKSIZE; i++) {
+        sk_stacklet_init(&s->stack[i]);
+    }
+
+    s->pos = -1;
+}
+#line 606 "core.org"
+int sk_stacklet_isnone(sk_stacklet *s)
+{
+    return s->type == SK_TYPE_NONE;
+}
+
+int sk_stacklet_isconstant(sk_stacklet *s)
+{
+    return s->type == SK_TYPE_CONSTANT;
+}
+
+int sk_stacklet_iscable(sk_stacklet *s)
+{
+    return s->type == SK_TYPE_CABLE;
+}
+
+int sk_stacklet_istable(sk_stacklet *s)
+{
+    return s->type == SK_TYPE_TABLE;
+}
+
+int sk_stacklet_isgeneric(sk_stacklet *s)
+{
+    return s->type == SK_TYPE_GENERIC;
+}
+#line 650 "core.org"
+int sk_stack_pop(sk_stack *stack, sk_stacklet **out)
+{
+    sk_stacklet *s;
+    /* no items on stack */
+    if (stack->pos < 0) return 1;
+
+    /* stack overflow */
+    if (stack->pos >= SK_STACKSIZE) return 2;
+
+    s = &stack->stack[stack->pos];
+    stack->pos--;
+
+    *out = s;
+    return 0;
+}
+#line 669 "core.org"
+int sk_stack_push(sk_stack *stack, sk_stacklet **out)
+{
+    sk_stacklet *s;
+
+    if (stack->pos >= (SK_STACKSIZE - 1)) return 1;
+    stack->pos++;
+    s = &stack->stack[stack->pos];
+
+    sk_stacklet_init(s);
+    *out = s;
+    return 0;
+}
+#line 693 "core.org"
+int sk_stack_peak(sk_stack *stack, sk_stacklet **out)
+{
+    sk_stacklet *s;
+    if (stack->pos < 0) return 1;
+    if (stack->pos >= SK_STACKSIZE) return 2;
+
+    s = &stack->stack[stack->pos];
+    *out = s;
+    return 0;
+}
+#line 718 "core.org"
+int sk_stack_dup(sk_stack *stack, sk_stacklet **out)
+{
+    int rc;
+    sk_stacklet *a, *b;
+
+    rc = sk_stack_peak(stack, &a);
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_stack_push(stack, &b);
+    SK_ERROR_CHECK(rc);
+
+    *b = *a;
+
+    if (out != NULL) *out = b;
+
+    return 0;
+}
+#line 748 "core.org"
+static int has_buffer(sk_stacklet *s)
+{
+    if (s->type != SK_TYPE_CABLE) return 0;
+    return gf_cable_is_block((gf_cable *)s->ptr);
+}
+#line 762 "core.org"
+int sk_core_dup(sk_core *core)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_stack_dup(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (has_buffer(s)) {
+        gf_stack *stack;
+        stack = gf_patch_stack(core->patch);
+        gf_stack_dup(stack);
+    }
+
+    return 0;
+}
+#line 794 "core.org"
+int sk_stack_drop(sk_stack *stack, sk_stacklet **out)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_pop(stack, &s);
+
+    SK_ERROR_CHECK(rc);
+
+    if (out != NULL) *out = s;
+    return 0;
+}
+#line 819 "core.org"
+int sk_core_drop(sk_core *core)
+{
+    int rc;
+    sk_stacklet *s;
+    rc = sk_stack_drop(&core->stack, &s);
+
+    SK_ERROR_CHECK(rc);
+
+    if (has_buffer(s)) {
+        gf_stack *stack;
+        stack = gf_patch_stack(core->patch);
+        gf_stack_pop(stack, NULL);
+    }
+
+    return 0;
+}
+#line 854 "core.org"
+int sk_stack_swap(sk_stack *stack,
+                  sk_stacklet **out1,
+                  sk_stacklet **out2)
+{
+    sk_stacklet tmp;
+    int pos;
+
+    pos = stack->pos;
+    if (pos < 1) return 1;
+
+
+    tmp = stack->stack[pos];
+
+    stack->stack[pos] = stack->stack[pos - 1];
+    stack->stack[pos - 1] = tmp;
+
+    if (out1 != NULL) *out1 = &stack->stack[pos - 1];
+    if (out2 != NULL) *out2 = &stack->stack[pos];
+
+    return 0;
+}
+#line 887 "core.org"
+int sk_core_swap(sk_core *core)
+{
+    int rc;
+    sk_stacklet *s[2];
+    rc = sk_stack_swap(&core->stack, &s[0], &s[1]);
+
+    SK_ERROR_CHECK(rc);
+
+    if (has_buffer(s[0]) && has_buffer(s[1])) {
+        gf_stack *stack;
+        stack = gf_patch_stack(core->patch);
+        gf_stack_swap(stack);
+    }
+
+    return 0;
+}
+#line 912 "core.org"
+int sk_core_stackpos(sk_core *core)
+{
+    return core->stack.pos;
+}
+#line 931 "core.org"
+int sk_core_bufpeak(sk_core *core)
+{
+    return gf_bufferpool_peak(gf_patch_pool(core->patch));
+}
+
+int sk_core_stkpeak(sk_core *core)
+{
+    return gf_stack_peak(gf_patch_stack(core->patch));
+}
+#line 972 "core.org"
+gf_cable* sk_param_cable(sk_param *p)
+{
+    return p->data.c;
+}
+
+SKFLT sk_param_constant(sk_param *p)
+{
+    return p->data.f;
+}
+#line 998 "core.org"
+int sk_param_get(sk_core *core, sk_param *p)
+{
+    sk_stack *stk;
+    sk_stacklet *s;
+    int rc;
+
+    stk = &core->stack;
+
+    rc = sk_stack_pop(stk, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type == SK_TYPE_CONSTANT) {
+        p->type = 0;
+        p->data.f = s->f;
+    } else if (s->type == SK_TYPE_CABLE) {
+        p->type = 1;
+        p->data.c = (gf_cable *)s->ptr;
+        gf_cable_pop(p->data.c);
+    } else {
+        /* Wrong type! */
+        return 1;
+    }
+
+    return 0;
+}
+#line 1035 "core.org"
+int sk_param_get_constant(sk_core *core, SKFLT *val)
+{
+    sk_stack *stk;
+    sk_stacklet *s;
+    int rc;
+
+    stk = &core->stack;
+
+    rc = sk_stack_pop(stk, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_CONSTANT) {
+        /* Wrong type! */
+        return 1;
+    }
+
+    *val = s->f;
+    return 0;
+}
+#line 1066 "core.org"
+int sk_param_get_cable(sk_core *core, sk_param *p)
+{
+    sk_stack *stk;
+    sk_stacklet *s;
+    int rc;
+
+    stk = &core->stack;
+
+    rc = sk_stack_pop(stk, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type == SK_TYPE_CABLE) {
+        p->type = 1;
+        p->data.c = (gf_cable *)s->ptr;
+        gf_cable_pop(p->data.c);
+    } else {
+        /* Wrong type! */
+        return 1;
+    }
+
+    return 0;
+}
+#line 1102 "core.org"
+int sk_param_set(sk_core *core,
+                 gf_node *node,
+                 sk_param *p,
+                 int cid)
+{
+    gf_cable *c;
+
+    gf_node_get_cable(node, cid, &c);
+    if (p->type == 0) {
+        gf_cable_set_value(c, p->data.f);
+    } else {
+        int rc;
+        rc = gf_cable_connect(p->data.c, c);
+        SK_GF_ERROR_CHECK(rc);
+    }
+    return 0;
+}
+#line 1137 "core.org"
+int sk_core_constant(sk_core *core, SKFLT x)
+{
+    int rc;
+    sk_stacklet *s;
+    sk_stack *stk;
+
+    stk = &core->stack;
+
+    rc = sk_stack_push(stk, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_CONSTANT;
+    s->f = x;
+
+    return 0;
+}
+#line 1173 "core.org"
+int sk_param_out(sk_core *core,
+                 gf_node *node,
+                 int cid)
+{
+    gf_cable *c;
+    sk_stacklet *s;
+    sk_stack *stk;
+    int rc;
+    SKFLT val;
+
+    stk = &core->stack;
+
+    if (gf_patch_fold_node(core->patch, node, &val) == GF_OK) {
+        return sk_core_constant(core, val);
+    }
+
+    rc = sk_stack_push(stk, &s);
+    SK_ERROR_CHECK(rc);
+    rc = gf_node_get_cable(node, cid, &c);
+    SK_GF_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_CABLE;
+    s->ptr = c;
+
+    return 0;
+}
+#line 1221 "core.org"
+int sk_core_generic_push(sk_core *core, void *ptr)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_push(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_GENERIC;
+    s->ptr = ptr;
+
+    return rc;
+}
+#line 1238 "core.org"
+int sk_core_generic_pop(sk_core *core, void **ptr)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_pop(&core->stack, &s);
+
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_GENERIC) {
+        return 1;
+    }
+
+    if (ptr != NULL) *ptr = s->ptr;
+
+    return rc;
+}
+#line 1269 "core.org"
+int sk_param_isconstant(sk_param *p)
+{
+    return p->type == 0;
+}
+
+int sk_param_iscable(sk_param *p)
+{
+    return p->type == 1;
+}
+#line 1320 "core.org"
+void sk_register_entry_init(sk_register_entry *e)
+{
+    sk_stacklet_init(&e->data);
+    e->flags = 0;
+}
+#line 1354 "core.org"
+void sk_regtbl_init(sk_regtbl *rs)
+{
+    int i;
+
+    for (i = 0; i < SK_REGSIZE; i++) {
+        sk_register_entry_init(&rs->r[i]);
+    }
+}
+#line 1383 "core.org"
+int sk_register_get(sk_regtbl *rt, int pos, sk_stacklet *s)
+{
+    if (pos < 0 || pos >= SK_REGSIZE) return 1;
+
+    *s = rt->r[pos].data;
+    return 0;
+}
+#line 1398 "core.org"
+int sk_core_regget(sk_core *core, int pos)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_push(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+    rc = sk_register_get(&core->regtbl, pos, s);
+    SK_ERROR_CHECK(rc);
+
+    /* also push to buffer stack if cable */
+    if (has_buffer(s)) {
+        gf_cable *c;
+        gf_buffer *b;
+        gf_stack *bstack;
+        c = (gf_cable *) s->ptr;
+        b = gf_cable_get_buffer(c);
+        bstack = gf_patch_stack(core->patch);
+        gf_stack_push_buffer(bstack, b);
+    }
+
+    return 0;
+}
+#line 1425 "core.org"
+int sk_register_set(sk_regtbl *rt, int pos, sk_stacklet *s)
+{
+    if (pos < 0 || pos >= SK_REGSIZE) return 1;
+
+    rt->r[pos].data = *s;
+    return 0;
+}
+#line 1436 "core.org"
+int sk_core_regset(sk_core *core, int pos)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_pop(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+    rc = sk_register_set(&core->regtbl, pos, s);
+    SK_ERROR_CHECK(rc);
+
+    return 0;
+}
+#line 1461 "core.org"
+int sk_register_mark(sk_regtbl *rt, int pos)
+{
+    if (pos < 0 || pos >= SK_REGSIZE) return 1;
+
+    rt->r[pos].flags |= 1;
+    return 0;
+}
+#line 1472 "core.org"
+int sk_core_regmrk(sk_core *core, int pos)
+{
+    return sk_register_mark(&core->regtbl, pos);
+}
+#line 1490 "core.org"
+int sk_register_clear(sk_regtbl *rt, int pos)
+{
+    if (pos < 0 || pos >= SK_REGSIZE) return 1;
+
+    rt->r[pos].flags = 0;
+    return 0;
+}
+#line 1501 "core.org"
+int sk_core_regclr(sk_core *core, int pos)
+{
+    return sk_register_clear(&core->regtbl, pos);
+}
+#line 1525 "core.org"
+int sk_register_nxtfree(sk_regtbl *rt, int start)
+{
+    int pos;
+    int i;
+    sk_register_entry *reg;
+
+    reg = rt->r;
+
+    if (start < 0 || start >= SK_REGSIZE) start = 0;
+
+    pos = start;
+
+    for (i = 0; i < SK_REGSIZE; i++) {
+        if (!(reg[pos].flags & 1)) return pos;
+        pos = (pos + 1) % SK_REGSIZE;
+    }
+
+    return -1;
+}
+#line 1552 "core.org"
+int sk_core_regnxt(sk_core *core, int start, int *pos)
+{
+    *pos = sk_register_nxtfree(&core->regtbl, start);
+
+    if (*pos < 0) return 1;
+
+    return 0;
+}
+#line 1634 "core.org"
+void sk_pqueue_init(sk_pqueue *q)
+{
+    q->head = 0;
+    q->tail = 0;
+}
+#line 1663 "core.org"
+static void live_compute(gf_node *node)
+{
+    sk_live *live;
+    GFFLT *out;
+    int blksize;
+    int pos;
+    int n;
+
+    live = gf_node_get_data(node);
+    blksize = gf_node_blksize(node);
+    out = gf_cable_data(live->out);
+
+    pos = live->pos < 0 ? blksize : live->pos;
+
+    for (n = 0; n < pos; n++) out[n] = live->val;
+    for (n = pos; n < blksize; n++) out[n] = live->next;
+
+    gf_cable_silent_set(live->out,
+                        live->val == 0 &&
+                        (pos == blksize || live->next == 0));
+
+    if (live->pos >= 0) {
+        live->val = live->next;
+        live->pos = -1;
+    }
+}
+
+static void live_destroy(gf_node *node)
+{
+    gf_patch *patch;
+    void *ud;
+    int rc;
+
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    ud = gf_node_get_data(node);
+    gf_memory_free(patch, &ud);
+}
+
+int sk_core_live(sk_core *core, SKFLT init, sk_live **out)
+{
+    gf_patch *patch;
+    gf_node *node;
+    sk_live *live;
+    void *ud;
+    int rc;
+
+    patch = core->patch;
+
+    rc = gf_memory_alloc(patch, sizeof(sk_live), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    live = ud;
+
+    live->val = init;
+    live->next = init;
+    live->pos = -1;
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 0);
+    gf_node_get_cable(node, 0, &live->out);
+
+    gf_node_set_type(node, SK_NODE_LIVE);
+    gf_node_set_data(node, live);
+    gf_node_set_compute(node, live_compute);
+    gf_node_set_destroy(node, live_destroy);
+
+    rc = sk_param_out(core, node, 0);
+    SK_ERROR_CHECK(rc);
+
+    if (out != NULL) *out = live;
+
+    return 0;
+}
+#line 1766 "core.org"
+int sk_core_live_reg(sk_core *core, int reg, sk_live **live)
+{
+    sk_stacklet s;
+    gf_cable *c;
+    gf_node *node;
+    int rc;
+
+    rc = sk_register_get(&core->regtbl, reg, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s.type != SK_TYPE_CABLE) return 1;
+
+    c = s.ptr;
+    node = c->node;
+
+    if (node == NULL || gf_node_get_type(node) != SK_NODE_LIVE) {
+        return 1;
+    }
+
+    *live = gf_node_get_data(node);
+    return 0;
+}
+
+int sk_core_live_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_live *live)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_sappend(&core->dict, key, sz, live, NULL, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_LIVE;
+    return 0;
+}
+
+int sk_core_live_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_live **live)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_lookup_stacklet(&core->dict, key, sz, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_LIVE) return 1;
+
+    *live = s->ptr;
+    return 0;
+}
+#line 1832 "core.org"
+unsigned long sk_core_time(sk_core *core)
+{
+    return core->time;
+}
+#line 1856 "core.org"
+int sk_core_pqpush(sk_core *core,
+                   sk_live *live,
+                   unsigned long time,
+                   SKFLT val)
+{
+    sk_pqueue *q;
+    sk_pqevent *ev;
+    unsigned long head;
+
+    q = &core->pq;
+    head = q->head;
+
+    if (head - q->tail >= SK_PQSIZE) return 1;
+
+    ev = &q->ev[head & (SK_PQSIZE - 1)];
+    ev->live = live;
+    ev->time = time;
+    ev->val = val;
+
+    SK_BARRIER();
+    q->head = head + 1;
+
+    return 0;
+}
+#line 1898 "core.org"
+static void pqueue_apply(sk_core *core, int len)
+{
+    sk_pqueue *q;
+    sk_pqevent *ev;
+    unsigned long tail, head;
+    unsigned long end;
+    sk_live *live;
+
+    q = &core->pq;
+    tail = q->tail;
+    head = q->head;
+    SK_BARRIER();
+
+    end = core->time + len;
+
+    while (tail != head) {
+        ev = &q->ev[tail & (SK_PQSIZE - 1)];
+        if (ev->time >= end) break;
+
+        live = ev->live;
+        if (live->pos < 0) {
+            live->pos = 0;
+            if (ev->time > core->time) live->pos = ev->time - core->time;
+        }
+        live->next = ev->val;
+
+        tail++;
+    }
+
+    SK_BARRIER();
+    q->tail = tail;
+}
+#line 1981 "core.org"
+void sk_evqueue_init(sk_evqueue *q)
+{
+    q->head = 0;
+    q->tail = 0;
+}
+#line 1998 "core.org"
+static void evqueue_clean(sk_evqueue *q)
+{
+    sk_event *ev;
+
+    while (q->tail != q->head) {
+        ev = &q->ev[q->tail & (SK_EVQSIZE - 1)];
+        if (ev->del != NULL) ev->del(ev->ud);
+        q->tail++;
+    }
+}
+#line 2031 "core.org"
+int sk_core_event(sk_core *core,
+                  unsigned long time,
+                  void (*fn)(sk_core *, void *),
+                  void (*del)(void *),
+                  void *ud)
+{
+    sk_evqueue *q;
+    sk_event *ev;
+    unsigned long head;
+
+    q = &core->evq;
+    head = q->head;
+
+    if (head - q->tail >= SK_EVQSIZE) return 1;
+
+    ev = &q->ev[head & (SK_EVQSIZE - 1)];
+    ev->time = time;
+    ev->fn = fn;
+    ev->del = del;
+    ev->ud = ud;
+
+    SK_BARRIER();
+    q->head = head + 1;
+
+    return 0;
+}
+#line 2070 "core.org"
+static int evqueue_fire(sk_core *core, int len)
+{
+    sk_evqueue *q;
+    sk_event *ev;
+    unsigned long tail, head;
+
+    q = &core->evq;
+    tail = q->tail;
+    head = q->head;
+    SK_BARRIER();
+
+    while (tail != head) {
+        ev = &q->ev[tail & (SK_EVQSIZE - 1)];
+
+        if (ev->time > core->time) {
+            if (ev->time - core->time < (unsigned long)len) {
+                len = ev->time - core->time;
+            }
+            break;
+        }
+
+        ev->fn(core, ev->ud);
+        if (ev->del != NULL) ev->del(ev->ud);
+        tail++;
+    }
+
+    SK_BARRIER();
+    q->tail = tail;
+
+    return len;
+}
+#line 2228 "core.org"
+static void voice_compute(gf_node *node)
+{
+    sk_voice *v;
+    GFFLT *gate, *note, *vel;
+    int blksize;
+    int n, c, i;
+
+    v = gf_node_get_data(node);
+    blksize = gf_node_blksize(node);
+
+    gate = gf_cable_data(v->ctl[SK_VOICE_GATE]);
+    note = gf_cable_data(v->ctl[SK_VOICE_NOTE]);
+    vel = gf_cable_data(v->ctl[SK_VOICE_VEL]);
+
+    c = 0;
+    for (n = 0; n < blksize; n++) {
+        while (c < v->nchg && v->chg[c].pos <= n) {
+            v->gate = v->chg[c].gate;
+            v->note = v->chg[c].note;
+            v->vel = v->chg[c].vel;
+            c++;
+        }
+
+        gate[n] = v->gate;
+        note[n] = v->note;
+        vel[n] = v->vel;
+    }
+
+    for (i = 0; c < v->nchg; i++, c++) {
+        v->chg[i] = v->chg[c];
+        v->chg[i].pos -= blksize;
+    }
+
+    v->nchg = i;
+}
+#line 2271 "core.org"
+static void voice_change(sk_voice *v, int pos, SKFLT gate)
+{
+    sk_voicechg *chg;
+
+    if (v->nchg < SK_VOICE_NCHG) v->nchg++;
+    chg = &v->chg[v->nchg - 1];
+
+    chg->pos = pos;
+    chg->gate = gate;
+    chg->note = v->note;
+    chg->vel = v->vel;
+}
+#line 2297 "core.org"
+static sk_voice *poly_pick(sk_poly *poly, SKFLT note)
+{
+    sk_voice *v, *best;
+    int i;
+
+    best = NULL;
+
+    for (i = 0; i < poly->nvoices; i++) {
+        v = &poly->voice[i];
+        if (v->held && v->note == note) return v;
+    }
+
+    for (i = 0; i < poly->nvoices; i++) {
+        v = &poly->voice[i];
+        if (v->held) continue;
+        if (v->asleep) return v;
+        if (best == NULL || v->stamp < best->stamp) best = v;
+    }
+
+    if (best != NULL) return best;
+
+    best = &poly->voice[0];
+    for (i = 1; i < poly->nvoices; i++) {
+        v = &poly->voice[i];
+        if (v->stamp < best->stamp) best = v;
+    }
+
+    return best;
+}
+
+static void poly_noteon(sk_poly *poly, int pos, SKFLT note, SKFLT vel)
+{
+    sk_voice *v;
+    SKFLT gate;
+
+    v = poly_pick(poly, note);
+
+    /* the gate at pos, once earlier changes have happened */
+    gate = v->nchg > 0 ? v->chg[v->nchg - 1].gate : v->gate;
+
+    if (gate != 0) {
+        voice_change(v, pos, 0);
+        pos++;
+    }
+
+    v->note = note;
+    v->vel = vel;
+    voice_change(v, pos, 1);
+
+    v->held = 1;
+    v->asleep = 0;
+    v->stamp = ++poly->stamp;
+}
+
+static void poly_noteoff(sk_poly *poly, int pos, SKFLT note)
+{
+    sk_voice *v;
+    int i;
+
+    for (i = 0; i < poly->nvoices; i++) {
+        v = &poly->voice[i];
+        if (!v->held || v->note != note) continue;
+
+        voice_change(v, pos, 0);
+        v->held = 0;
+        v->stamp = ++poly->stamp;
+        return;
+    }
+}
+
+static void poly_events(sk_poly *poly, int blksize)
+{
+    sk_polyevent *ev;
+    unsigned long tail, head;
+    unsigned long now, end;
+    int pos;
+
+    tail = poly->tail;
+    head = poly->head;
+    SK_BARRIER();
+
+    now = poly->core->time;
+    end = now + blksize;
+
+    while (tail != head) {
+        ev = &poly->ev[tail & (SK_POLYQSIZE - 1)];
+        if (ev->time >= end) break;
+
+        pos = 0;
+        if (ev->time > now) pos = ev->time - now;
+
+        if (ev->vel > 0) poly_noteon(poly, pos, ev->note, ev->vel);
+        else poly_noteoff(poly, pos, ev->note);
+
+        tail++;
+    }
+
+    SK_BARRIER();
+    poly->tail = tail;
+}
+#line 2406 "core.org"
+static void poly_compute(gf_node *node)
+{
+    sk_poly *poly;
+    sk_voice *v;
+    GFFLT *out, *vout;
+    int blksize;
+    int i, n;
+    int idle;
+
+    poly = gf_node_get_data(node);
+    blksize = gf_node_blksize(node);
+    out = gf_cable_data(poly->out);
+
+    poly_events(poly, blksize);
+
+    for (n = 0; n < blksize; n++) out[n] = 0;
+
+    poly->nactive = 0;
+
+    for (i = 0; i < poly->nvoices; i++) {
+        v = &poly->voice[i];
+
+        idle = !v->held && v->nchg == 0 && v->gate == 0;
+        v->asleep = gf_tail_skip(&v->tail, idle, blksize);
+        if (v->asleep) continue;
+
+        gf_subpatch_compute(&v->sub);
+
+        vout = gf_cable_data(v->out);
+        for (n = 0; n < blksize; n++) out[n] += vout[n];
+        gf_tail_check(&v->tail, vout, blksize);
+
+        poly->nactive++;
+    }
+
+    gf_cable_silent_set(poly->out, poly->nactive == 0);
+}
+
+static void voice_destroy(gf_node *node)
+{
+    gf_node_cables_free(node);
+}
+
+static void poly_destroy(gf_node *node)
+{
+    gf_patch *patch;
+    sk_poly *poly;
+    void *ud;
+    int i;
+    int rc;
+
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+
+    poly = gf_node_get_data(node);
+
+    for (i = 0; i < poly->nvoices; i++) {
+        gf_subpatch_destroy(&poly->voice[i].sub);
+        gf_subpatch_free(&poly->voice[i].sub);
+    }
+
+    gf_node_cables_free(node);
+
+    ud = poly->voice;
+    gf_memory_free(patch, &ud);
+    ud = poly;
+    gf_memory_free(patch, &ud);
+}
+#line 2495 "core.org"
+static int voice_build(sk_core *core,
+                       sk_voice *v,
+                       int (*voice)(sk_core *, void *),
+                       void *ud)
+{
+    gf_patch *patch;
+    gf_node *node;
+    gf_buffer *buf;
+    sk_param out;
+    int pos;
+    int rc;
+    int c;
+
+    patch = core->patch;
+
+    gf_subpatch_init(&v->sub);
+    gf_subpatch_begin(patch, &v->sub);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 3);
+    SK_GF_ERROR_CHECK(rc);
+
+    for (c = 0; c < 3; c++) {
+        rc = gf_node_set_block(node, c);
+        SK_GF_ERROR_CHECK(rc);
+        gf_node_get_cable(node, c, &v->ctl[c]);
+    }
+
+    for (c = 0; c < 3; c++) {
+        rc = gf_patch_bhold(patch, NULL);
+        SK_GF_ERROR_CHECK(rc);
+    }
+
+    gf_node_set_data(node, v);
+    gf_node_set_compute(node, voice_compute);
+    gf_node_set_destroy(node, voice_destroy);
+
+    out.data.c = NULL;
+    pos = sk_core_stackpos(core);
+    rc = voice(core, ud);
+    if (!rc && sk_core_stackpos(core) != pos + 1) rc = 1;
+    if (!rc) rc = sk_param_get_cable(core, &out);
+
+    for (c = 0; c < 3; c++) {
+        buf = gf_cable_get_buffer(v->ctl[c]);
+        gf_patch_bunhold(patch, buf);
+    }
+
+    gf_subpatch_end(patch, &v->sub);
+    SK_ERROR_CHECK(rc);
+
+    gf_subpatch_set_out(&v->sub, sk_param_cable(&out));
+
+    return 0;
+}
+
+int sk_core_poly(sk_core *core,
+                 int nvoices,
+                 int (*voice)(sk_core *, void *),
+                 void *ud,
+                 sk_poly **out)
+{
+    gf_patch *patch;
+    gf_node *node;
+    sk_poly *poly;
+    sk_poly *prev;
+    sk_voice *v;
+    void *tmp;
+    int rc;
+    int i;
+
+    if (nvoices < 1) return 1;
+
+    patch = core->patch;
+
+    rc = gf_memory_alloc(patch, sizeof(sk_poly), &tmp);
+    SK_GF_ERROR_CHECK(rc);
+    poly = tmp;
+
+    rc = gf_memory_alloc(patch, sizeof(sk_voice) * nvoices, &tmp);
+    SK_GF_ERROR_CHECK(rc);
+    poly->voice = tmp;
+
+    poly->core = core;
+    poly->nvoices = 0;
+    poly->nactive = 0;
+    poly->stamp = 0;
+    poly->head = 0;
+    poly->tail = 0;
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, nvoices + 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 0);
+    gf_node_get_cable(node, 0, &poly->out);
+
+    gf_node_set_flags(node, GF_NODE_SERIAL);
+    gf_node_set_data(node, poly);
+    gf_node_set_compute(node, poly_compute);
+    gf_node_set_destroy(node, poly_destroy);
+
+    prev = core->poly;
+    core->poly = poly;
+
+    rc = 0;
+    for (i = 0; i < nvoices; i++) {
+        v = &poly->voice[i];
+
+        v->gate = v->note = v->vel = 0;
+        v->nchg = 0;
+        v->held = 0;
+        v->stamp = 0;
+        v->asleep = 0;
+        gf_tail_init(&v->tail, gf_patch_srate_get(patch) * 0.05);
+        /* voices start out asleep */
+        v->tail.count = v->tail.hold;
+
+        rc = voice_build(core, v, voice, ud);
+        if (rc) break;
+
+        gf_node_get_cable(node, i + 1, &v->out);
+        gf_cable_connect_nocheck(gf_subpatch_out(&v->sub), v->out);
+        poly->nvoices++;
+    }
+
+    core->poly = prev;
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_param_out(core, node, 0);
+    SK_ERROR_CHECK(rc);
+
+    if (out != NULL) *out = poly;
+
+    return 0;
+}
+
+int sk_core_voice(sk_core *core, int ctl)
+{
+    sk_stacklet *s;
+    sk_voice *v;
+    int rc;
+
+    if (core->poly == NULL) return 1;
+    if (ctl < 0 || ctl > 2) return 1;
+
+    v = &core->poly->voice[core->poly->nvoices];
+
+    rc = sk_stack_push(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_CABLE;
+    s->ptr = v->ctl[ctl];
+
+    gf_stack_push_buffer(gf_patch_stack(core->patch),
+                         gf_cable_get_buffer(v->ctl[ctl]));
+
+    return 0;
+}
+#line 2680 "core.org"
+int sk_core_poly_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_poly *poly)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_sappend(&core->dict, key, sz, poly, NULL, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_POLY;
+    return 0;
+}
+
+int sk_core_poly_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_poly **poly)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_lookup_stacklet(&core->dict, key, sz, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_POLY) return 1;
+
+    *poly = s->ptr;
+    return 0;
+}
+#line 2733 "core.org"
+static int poly_push(sk_poly *poly,
+                     unsigned long time,
+                     SKFLT note,
+                     SKFLT vel)
+{
+    sk_polyevent *ev;
+    unsigned long head;
+
+    head = poly->head;
+
+    if (head - poly->tail >= SK_POLYQSIZE) return 1;
+
+    ev = &poly->ev[head & (SK_POLYQSIZE - 1)];
+    ev->time = time;
+    ev->note = note;
+    ev->vel = vel;
+
+    SK_BARRIER();
+    poly->head = head + 1;
+
+    return 0;
+}
+
+int sk_poly_noteon(sk_poly *poly,
+                   unsigned long time,
+                   SKFLT note,
+                   SKFLT vel)
+{
+    /* a velocity of 0 would be a note off */
+    if (vel <= 0) return 1;
+    return poly_push(poly, time, note, vel);
+}
+
+int sk_poly_noteoff(sk_poly *poly, unsigned long time, SKFLT note)
+{
+    return poly_push(poly, time, note, 0);
+}
+#line 2782 "core.org"
+int sk_poly_active(sk_poly *poly)
+{
+    return poly->nactive;
+}
+#line 2856 "core.org"
+sk_swap * sk_swap_new(int blksize, int fade)
+{
+    sk_swap *swap;
+
+    swap = malloc(sizeof(sk_swap));
+
+    if (blksize <= 0) blksize = 64;
+    if (fade < 0) fade = 0;
+
+    swap->cur = NULL;
+    swap->curout = NULL;
+    swap->old = NULL;
+    swap->oldout = NULL;
+    swap->fade = fade;
+    swap->pos = fade;
+    swap->blksize = blksize;
+    swap->time = 0;
+    swap->next = NULL;
+    swap->nextout = NULL;
+    swap->submitted = 0;
+    swap->trash = NULL;
+    swap->latency = 0;
+    swap->maxlatency = 0;
+
+    return swap;
+}
+
+void sk_swap_del(sk_swap *swap)
+{
+    if (swap == NULL) return;
+
+    sk_core_del(swap->cur);
+    sk_core_del(swap->old);
+    sk_core_del(swap->next);
+    sk_core_del(swap->trash);
+    free(swap);
+}
+#line 2912 "core.org"
+int sk_swap_submit(sk_swap *swap, sk_core *core)
+{
+    sk_param out;
+    int rc;
+
+    if (swap->next != NULL) return 1;
+    if (gf_patch_blksize(core->patch) != swap->blksize) return 1;
+
+    rc = sk_param_get_cable(core, &out);
+    SK_ERROR_CHECK(rc);
+
+    swap->nextout = sk_param_cable(&out);
+    swap->submitted = swap->time;
+
+    SK_BARRIER();
+    swap->next = core;
+
+    return 0;
+}
+#line 2948 "core.org"
+int sk_swap_collect(sk_swap *swap)
+{
+    sk_core *trash;
+
+    trash = swap->trash;
+    if (trash == NULL) return 0;
+
+    SK_BARRIER();
+    sk_core_del(trash);
+    SK_BARRIER();
+    swap->trash = NULL;
+
+    return 1;
+}
+#line 2991 "core.org"
+static void swap_pickup(sk_swap *swap)
+{
+    sk_core *next;
+    unsigned long latency;
+
+    next = swap->next;
+
+    if (next == NULL) return;
+    if (swap->pos < swap->fade || swap->old != NULL) return;
+
+    SK_BARRIER();
+
+    swap->old = swap->cur;
+    swap->oldout = swap->curout;
+    swap->cur = next;
+    swap->curout = swap->nextout;
+    swap->pos = 0;
+
+    latency = swap->time + swap->blksize - swap->submitted;
+    swap->latency = latency;
+    if (latency > swap->maxlatency) swap->maxlatency = latency;
+
+    SK_BARRIER();
+    swap->next = NULL;
+}
+
+void sk_swap_compute(sk_swap *swap, SKFLT *out)
+{
+    int blksize;
+    int n;
+    SKFLT a, g;
+
+    blksize = swap->blksize;
+
+    swap_pickup(swap);
+
+    if (swap->cur != NULL) {
+        sk_core_compute(swap->cur);
+        for (n = 0; n < blksize; n++) {
+            out[n] = gf_cable_get(swap->curout, n);
+        }
+    } else {
+        for (n = 0; n < blksize; n++) out[n] = 0;
+    }
+
+    if (swap->pos < swap->fade) {
+        if (swap->old != NULL) sk_core_compute(swap->old);
+
+        for (n = 0; n < blksize; n++) {
+            a = 0;
+            if (swap->old != NULL) a = gf_cable_get(swap->oldout, n);
+
+            g = 1;
+            if (swap->pos < swap->fade) {
+                g = (SKFLT)swap->pos / swap->fade;
+                swap->pos++;
+            }
+
+            g *= 0.5 * M_PI;
+            out[n] = out[n] * sin(g) + a * cos(g);
+        }
+    }
+
+    if (swap->pos >= swap->fade &&
+        swap->old != NULL &&
+        swap->trash == NULL) {
+        SK_BARRIER();
+        swap->trash = swap->old;
+        swap->old = NULL;
+    }
+
+    swap->time += blksize;
+}
+#line 3086 "core.org"
+void sk_swap_latency(sk_swap *swap,
+                     unsigned long *last,
+                     unsigned long *max)
+{
+    if (last != NULL) *last = swap->latency;
+    if (max != NULL) *max = swap->maxlatency;
+}
+#line 3130 "core.org"
+struct swap_node {
+    sk_swap *swap;
+    SKFLT *buf;
+    int pos;
+};
+
+static void swap_node_compute(gf_node *node)
+{
+    struct swap_node *sn;
+    gf_cable *out;
+    GFFLT *o;
+    int blksize;
+    int n;
+
+    sn = gf_node_get_data(node);
+    gf_node_get_cable(node, 0, &out);
+    o = gf_cable_data(out);
+    blksize = gf_node_blksize(node);
+
+    for (n = 0; n < blksize; n++) {
+        if (sn->pos >= sn->swap->blksize) {
+            sk_swap_compute(sn->swap, sn->buf);
+            sn->pos = 0;
+        }
+        o[n] = sn->buf[sn->pos++];
+    }
+}
+
+static void swap_node_destroy(gf_node *node)
+{
+    gf_patch *patch;
+    struct swap_node *sn;
+    void *ud;
+    int rc;
+
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    sn = gf_node_get_data(node);
+    ud = sn->buf;
+    gf_memory_free(patch, &ud);
+    ud = sn;
+    gf_memory_free(patch, &ud);
+}
+
+int sk_core_swapper(sk_core *core, sk_swap *swap)
+{
+    gf_patch *patch;
+    gf_node *node;
+    struct swap_node *sn;
+    void *ud;
+    int rc;
+
+    patch = core->patch;
+    if (gf_patch_blksize(patch) != swap->blksize) return 1;
+
+    rc = gf_memory_alloc(patch, sizeof(struct swap_node), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    sn = ud;
+
+    rc = gf_memory_alloc(patch, sizeof(SKFLT) * swap->blksize, &ud);
+    SK_GF_ERROR_CHECK(rc);
+    sn->buf = ud;
+    sn->swap = swap;
+    sn->pos = swap->blksize;
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 0);
+    gf_node_set_data(node, sn);
+    gf_node_set_compute(node, swap_node_compute);
+    gf_node_set_destroy(node, swap_node_destroy);
+
+    return sk_param_out(core, node, 0);
+}
+
+static void swap_del(void *ptr)
+{
+    sk_swap_del(ptr);
+}
+
+int sk_core_swap_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_swap *swap)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_sappend(&core->dict, key, sz, swap, swap_del, &s);
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_SWAP;
+    return 0;
+}
+
+int sk_core_swap_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_swap **swap)
+{
+    sk_stacklet *s;
+    int rc;
+
+    rc = sk_dict_lookup_stacklet(&core->dict, key, sz, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_SWAP) return 1;
+
+    *swap = s->ptr;
+    return 0;
+}
+#line 3277 "core.org"
+int sk_core_hold(sk_core *core)
+{
+    int rc;
+    sk_stacklet *s;
+    rc = sk_stack_peak(&core->stack, &s);
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_CABLE) {
+        /* Wrong type, kiddo */
+        return 2;
+    }
+
+    if (!has_buffer(s)) return 0;
+
+    rc = gf_patch_bhold(core->patch, NULL);
+    SK_GF_ERROR_CHECK(rc);
+
+    return 0;
+}
+#line 3300 "core.org"
+int sk_core_unhold(sk_core *core)
+{
+    sk_param cable;
+    gf_buffer *buf;
+    gf_cable *c;
+    int rc;
+
+    rc = sk_param_get(core, &cable);
+    SK_ERROR_CHECK(rc);
+
+    if (cable.type != 1) {
+        /* Your princess is is another castle. */
+        return 2;
+    }
+
+    c = cable.data.c;
+    buf = gf_cable_get_buffer(c);
+    if (buf == NULL) return 0;
+    rc = gf_patch_bunhold(core->patch, buf);
+    SK_GF_ERROR_CHECK(rc);
+
+    return 0;
+}
+#line 3358 "core.org"
+static void free_table(gf_pointer *p)
+{
+    sk_table *tab;
+
+    tab = gf_pointer_data(p);
+
+    free(tab->tab);
+    free(tab);
+}
+
+int sk_core_table_new(sk_core *core, unsigned long sz)
+{
+    sk_table *tab;
+    int rc;
+    SKFLT *data;
+
+    tab = malloc(sizeof(sk_table));
+
+    if (tab == NULL) return 1;
+    data = malloc(sz * sizeof(SKFLT));
+    memset(data, 0, sz * sizeof(SKFLT));
+
+    sk_table_init(tab, data, sz);
+
+    gf_patch_append_userdata(core->patch, free_table, tab);
+
+    rc = sk_core_table_push(core, tab);
+    SK_ERROR_CHECK(rc);
+
+    return 0;
+}
+#line 3398 "core.org"
+void sk_table_init(sk_table *tab, SKFLT *data, unsigned long sz)
+{
+    tab->tab = data;
+    tab->sz = sz;
+}
+#line 3415 "core.org"
+size_t sk_table_size(sk_table *t)
+{
+    return t->sz;
+}
+
+SKFLT* sk_table_data(sk_table *t)
+{
+    return t->tab;
+}
+#line 3436 "core.org"
+int sk_core_table_push(sk_core *core, sk_table *tab)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_push(&core->stack, &s);
+
+    SK_ERROR_CHECK(rc);
+
+    s->type = SK_TYPE_TABLE;
+    s->ptr = tab;
+
+    return rc;
+}
+#line 3454 "core.org"
+int sk_core_table_pop(sk_core *core, sk_table **tab)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_stack_pop(&core->stack, &s);
+
+    SK_ERROR_CHECK(rc);
+
+    if (s->type != SK_TYPE_TABLE) {
+        fprintf(stderr, "uh oh type is %d\n", s->type);
+        return 1;
+    }
+
+    *tab = (sk_table *)s->ptr;
+
+    return rc;
+}
+#line 3494 "core.org"
+int sk_table_dump(sk_table *tab, const char *filename)
+{
+    FILE *fp;
+
+    fp = fopen(filename, "w");
+
+    if (fp == NULL) return 1;
+
+    fwrite(tab->tab, sizeof(SKFLT), tab->sz, fp);
+
+    fclose(fp);
+
+    return 0;
+}
+#line 3512 "core.org"
+int sk_core_tabdump(sk_core *core, const char *filename)
+{
+    int rc;
+    sk_table *tab;
+
+    rc = sk_core_table_pop(core, &tab);
+    SK_ERROR_CHECK(rc);
+
+    return sk_table_dump(tab, filename);
+}
+#line 3536 "core.org"
+int sk_core_tabload(sk_core *core, const char *filename)
+{
+    FILE *fp;
+    size_t flen;
+    int rc;
+    sk_table *tab;
+
+    fp = fopen(filename, "r");
+
+    if (fp == NULL) return 1;
+
+    fseek(fp, 0L, SEEK_END);
+
+    flen = ftell(fp);
+
+    sk_core_table_new(core, flen / sizeof(SKFLT));
+
+    rc = sk_core_table_pop(core, &tab);
+    SK_ERROR_CHECK(rc);
+
+    rewind(fp);
+    fread(tab->tab, 1, flen, fp);
+
+    rc = sk_core_table_push(core, tab);
+    SK_ERROR_CHECK(rc);
+    return 0;
+}
+#line 3595 "core.org"
+void sk_core_srand(sk_core *core, unsigned long val)
+{
+    core->rng = val;
+}
+#line 3617 "core.org"
+unsigned long sk_core_rand(sk_core *core)
+{
+    core->rng = (1103515245 * core->rng + 12345) % SK_CORE_RANDMAX;
+    return core->rng;
+}
+#line 3633 "core.org"
+SKFLT sk_core_randf(sk_core *core)
+{
+    return (SKFLT)sk_core_rand(core) / SK_CORE_RANDMAX;
+}
+#line 3684 "core.org"
+size_t sk_dict_sizeof(void)
+{
+    return sizeof(sk_dict);
+}
+#line 3699 "core.org"
+static int hash(const char *str, int sz, int mod)
+{
+    unsigned long h;
+    int i;
+
+    h = 5381;
+    i = 0;
+
+    for(i = 0; i < sz; i++) {
+        h = ((h << 5) + h) ^ str[i];
+        h %= 0x7FFFFFFF;
+    }
+
+    return h % mod;
+}
+#line 3723 "core.org"
+void sk_dict_init(sk_dict *d)
+{
+    int n;
+
+    for (n = 0; n < 64; n++) {
+        d->ent[n] = NULL;
+    }
+
+    d->sz = 0;
+}
+#line 3742 "core.org"
+int sk_dict_clean(sk_dict *d)
+{
+    int e;
+
+    for (e = 0; e < 64; e++) {
+        struct dict_entry *ent, *nxt;
+        ent = d->ent[e];
+
+        while (ent != NULL) {
+            nxt = ent->nxt;
+            if (ent->del != NULL) ent->del(ent->s.ptr);
+            free(ent->key);
+            free(ent);
+            ent = nxt;
+        }
+    }
+
+    return 0;
+}
+#line 3789 "core.org"
+int sk_dict_sappend(sk_dict *d,
+                    const char *key,
+                    int sz,
+                    void *p,
+                    void (*del)(void*),
+                    sk_stacklet **s)
+{
+    int pos;
+    struct dict_entry *ent;
+    int i;
+
+    pos = hash(key, sz, 64);
+
+    ent = d->ent[pos];
+
+    while (ent != NULL) {
+        if (ent->sz == sz && !strcmp(key, ent->key)) {
+            return 1;
+        }
+        ent = ent->nxt;
+    }
+
+    ent = malloc(sizeof(struct dict_entry));
+    ent->key = malloc(sz + 1);
+    ent->sz = sz;
+
+    for (i = 0; i < sz; i++) ent->key[i] = key[i];
+    ent->key[sz] = '\0';
+
+    sk_stacklet_init(&ent->s);
+    ent->s.type = SK_TYPE_GENERIC;
+    ent->s.ptr = p;
+    ent->del = del;
+    ent->nxt = d->ent[pos];
+    d->ent[pos] = ent;
+
+    if (s != NULL) *s = &ent->s;
+
+    return 0;
+}
+#line 3833 "core.org"
+int sk_dict_append(sk_dict *d,
+                   const char *key,
+                   int sz,
+                   void *p,
+                   void (*del)(void*))
+{
+    return sk_dict_sappend(d, key, sz, p, del, NULL);
+}
+#line 3856 "core.org"
+int sk_core_append(sk_core *core,
+                   const char *key,
+                   int sz,
+                   void *p,
+                   void (*del)(void*))
+{
+    return sk_dict_append(&core->dict, key, sz, p, del);
+}
+#line 3881 "core.org"
+int sk_dict_lookup_stacklet(sk_dict *d,
+                            const char *key,
+                            int sz,
+                            sk_stacklet **s)
+{
+    int pos;
+    struct dict_entry *ent;
+
+    pos = hash(key, sz, 64);
+
+    ent = d->ent[pos];
+
+    while (ent != NULL) {
+        if (ent->sz == sz && !strncmp(key, ent->key, sz)) {
+            *s = &ent->s;
+            return 0;
+        }
+        ent = ent->nxt;
+    }
+
+    return 1;
+}
+#line 3907 "core.org"
+int sk_dict_lookup(sk_dict *d,
+                   const char *key,
+                   int sz,
+                   void **p)
+{
+    int rc;
+    sk_stacklet *s;
+
+    rc = sk_dict_lookup_stacklet(d, key, sz, &s);
+
+    if (rc) return rc;
+
+    *p = s->ptr;
+    return 0;
+}
+#line 3937 "core.org"
+int sk_core_lookup(sk_core *core,
+                   const char *key,
+                   int sz,
+                   void **p)
+{
+    return sk_dict_lookup(&core->dict, key, sz, p);
+}
+#line 3953 "core.org"
+int sk_dict_remove(sk_dict *d, const char *key, int sz)
+{
+    int pos;
+    struct dict_entry *ent, *prv;
+
+    pos = hash(key, sz, 64);
+
+    ent = d->ent[pos];
+
+    prv = NULL;
+
+    while (ent != NULL) {
+        if (ent->sz == sz && !strncmp(key, ent->key, sz)) {
+
+            if (prv == NULL) {
+                d->ent[pos] = ent->nxt;
+            } else {
+                prv->nxt = ent->nxt;
+            }
+            if (ent->del) ent->del(ent->s.ptr);
+            free(ent->key);
+            free(ent);
+            return 0;
+        }
+        prv = ent;
+        ent = ent->nxt;
+    }
+    return 1;
+}
+#line 3996 "core.org"
+int sk_core_remove(sk_core *core,
+                   const char *key,
+                   int sz)
+{
+    return sk_dict_remove(&core->dict, key, sz);
+}
+#line 4019 "core.org"
+int sk_core_grab(sk_core *core,
+                 const char *key,
+                 int sz)
+{
+    int rc;
+    sk_stacklet *s;
+    sk_stacklet *out;
+
+    rc = sk_dict_lookup_stacklet(&core->dict, key, sz, &s);
+
+    if (rc) return 1;
+
+    rc = sk_stack_push(&core->stack, &out);
+
+    if (rc) return 2;
+
+    *out = *s;
+
+    return 0;
+}
+#line 4054 "core.org"
+static void deltab(void *ptr)
+{
+    sk_table *tab;
+
+    tab = ptr;
+
+    free(tab->tab);
+    free(tab);
+}
+
+int sk_core_append_table(sk_core *core,
+                         const char *key,
+                         int sz,
+                         int tabsz)
+{
+    int rc;
+    sk_table *tab;
+    sk_stacklet *s;
+    sk_stacklet *out;
+
+    tab = calloc(1, sizeof(sk_table));
+
+    tab->tab = calloc(tabsz, sizeof(SKFLT));
+    tab->sz = tabsz;
+
+    s = NULL;
+    rc = sk_dict_sappend(&core->dict, key, sz, tab, deltab, &s);
+    SK_ERROR_CHECK(rc);
+
+    out = NULL;
+
+    s->type = SK_TYPE_TABLE;
+
+    rc = sk_stack_push(&core->stack, &out);
+    SK_ERROR_CHECK(rc);
+
+    *out = *s;
+
+    return 0;
+}
+#line 4113 "core.org"
+int sk_core_share_tables(sk_core *dst, sk_core *src)
+{
+    int e;
+    struct dict_entry *ent;
+    sk_stacklet *s;
+
+    for (e = 0; e < 64; e++) {
+        ent = src->dict.ent[e];
+
+        while (ent != NULL) {
+            if (ent->s.type == SK_TYPE_TABLE) {
+                s = NULL;
+                if (!sk_dict_sappend(&dst->dict,
+                                     ent->key, ent->sz,
+                                     ent->s.ptr, NULL, &s)) {
+                    *s = ent->s;
+                }
+            }
+            ent = ent->nxt;
+        }
+    }
+
+    return 0;
+}
+#line 44 "core.org"
@@ -0,0 +1,500 @@
+#line 18 "core.org"
+#ifndef SKGF_H
+#define SKGF_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#line 122 "core.org"
+typedef struct sk_core sk_core;
+#line 475 "core.org"
+typedef struct sk_stacklet sk_stacklet;
+#line 532 "core.org"
+typedef struct sk_stack sk_stack;
+#line 955 "core.org"
+typedef struct {
+    char type;
+    union {
+        gf_cable *c;
+        SKFLT f;
+    } data;
+} sk_param;
+#line 1296 "core.org"
+typedef struct sk_register_entry sk_register_entry;
+#line 1334 "core.org"
+typedef struct sk_regtbl sk_regtbl;
+#line 1574 "core.org"
+typedef struct sk_live sk_live;
+typedef struct sk_pqueue sk_pqueue;
+#line 1950 "core.org"
+typedef struct sk_evqueue sk_evqueue;
+#line 2120 "core.org"
+typedef struct sk_poly sk_poly;
+typedef struct sk_voice sk_voice;
+#line 2803 "core.org"
+typedef struct sk_swap sk_swap;
+#line 3333 "core.org"
+typedef struct sk_table sk_table;
+#line 3657 "core.org"
+typedef struct sk_dict sk_dict;
+#line 26 "core.org"
+#ifdef SK_CORE_PRIV
+#line 480 "core.org"
+struct sk_stacklet {
+    int type;
+    SKFLT f;
+    void *ptr;
+};
+#line 541 "core.org"
+#define SK_STACKSIZE 16
+struct sk_stack {
+    sk_stacklet stack[SK_STACKSIZE];
+    int pos;
+};
+#line 480 "core.org"
+#line 1304 "core.org"
+struct sk_register_entry {
+    sk_stacklet data;
+    int flags;
+};
+#line 1339 "core.org"
+#define SK_REGSIZE 16
+struct sk_regtbl {
+    sk_register_entry r[SK_REGSIZE];
+};
+#line 1584 "core.org"
+struct sk_live {
+    SKFLT val;
+    SKFLT next;
+    int pos;
+    gf_cable *out;
+};
+#line 1599 "core.org"
+#define SK_PQSIZE 256
+
+typedef struct {
+    sk_live *live;
+    unsigned long time;
+    SKFLT val;
+} sk_pqevent;
+
+struct sk_pqueue {
+    sk_pqevent ev[SK_PQSIZE];
+    volatile unsigned long head;
+    volatile unsigned long tail;
+};
+#line 1958 "core.org"
+#define SK_EVQSIZE 256
+
+typedef struct {
+    unsigned long time;
+    void (*fn)(sk_core *, void *);
+    void (*del)(void *);
+    void *ud;
+} sk_event;
+
+struct sk_evqueue {
+    sk_event ev[SK_EVQSIZE];
+    volatile unsigned long head;
+    volatile unsigned long tail;
+};
+#line 2137 "core.org"
+#define SK_VOICE_NCHG 8
+
+typedef struct {
+    int pos;
+    SKFLT gate, note, vel;
+} sk_voicechg;
+
+struct sk_voice {
+    gf_subpatch sub;
+    gf_cable *ctl[3];
+    gf_cable *out;
+    SKFLT gate, note, vel;
+    sk_voicechg chg[SK_VOICE_NCHG];
+    int nchg;
+    int held;
+    unsigned long stamp;
+    gf_tail tail;
+    int asleep;
+};
+#line 2163 "core.org"
+#define SK_POLYQSIZE 256
+
+typedef struct {
+    unsigned long time;
+    SKFLT note;
+    SKFLT vel;
+} sk_polyevent;
+
+struct sk_poly {
+    sk_core *core;
+    sk_voice *voice;
+    int nvoices;
+    int nactive;
+    unsigned long stamp;
+    gf_cable *out;
+    sk_polyevent ev[SK_POLYQSIZE];
+    volatile unsigned long head;
+    volatile unsigned long tail;
+};
+#line 2820 "core.org"
+struct sk_swap {
+    sk_core *cur;
+    gf_cable *curout;
+    sk_core *old;
+    gf_cable *oldout;
+    int fade;
+    int pos;
+    int blksize;
+    volatile unsigned long time;
+
+    sk_core * volatile next;
+    gf_cable *nextout;
+    unsigned long submitted;
+
+    sk_core * volatile trash;
+
+    unsigned long latency;
+    unsigned long maxlatency;
+};
+#line 3338 "core.org"
+struct sk_table {
+    SKFLT *tab;
+    unsigned long sz;
+};
+#line 3662 "core.org"
+struct dict_entry {
+    char *key;
+    int sz;
+    /* void *val; */
+    sk_stacklet s;
+    void (*del)(void*);
+    struct dict_entry *nxt;
+};
+
+struct sk_dict {
+    struct dict_entry *ent[64];
+    int sz;
+};
+#line 26 "core.org"
+#line 127 "core.org"
+struct sk_core {
+    gf_patch *patch;
+    sk_stack stack;
+    sk_regtbl regtbl;
+    sk_dict dict;
+    unsigned long rng;
+    sk_pqueue pq;
+    sk_evqueue evq;
+    unsigned long time;
+    sk_poly *poly;
+};
+#line 29 "core.org"
+#endif
+#line 1620 "core.org"
+#ifdef __GNUC__
+#define SK_BARRIER() __sync_synchronize()
+#else
+#define SK_BARRIER()
+#endif
+#line 1650 "core.org"
+#define SK_NODE_LIVE 0x11fe
+#line 2206 "core.org"
+enum {
+    SK_VOICE_GATE,
+    SK_VOICE_NOTE,
+    SK_VOICE_VEL
+};
+#line 3570 "core.org"
+#define SK_ERROR_CHECK(rc) if (rc) return rc;
+#line 3575 "core.org"
+#define SK_GF_ERROR_CHECK(rc) if(rc != GF_OK) {\
+    fprintf(stderr, "Error: %s\n", gf_error(rc));\
+    return 1;\
+}
+#line 3612 "core.org"
+#define SK_CORE_RANDMAX 2147483648
+#line 29 "core.org"
+#line 70 "core.org"
+sk_core * sk_core_new(int sr, int blksize);
+void sk_core_del(sk_core *core);
+#line 152 "core.org"
+void sk_core_compute(sk_core *core);
+#line 183 "core.org"
+size_t sk_core_computes(sk_core *core, SKFLT secs);
+#line 207 "core.org"
+gf_patch * sk_core_patch(sk_core *core);
+#line 223 "core.org"
+size_t sk_core_seconds_to_blocks(sk_core *core, SKFLT secs);
+#line 249 "core.org"
+int sk_core_blkset(sk_core *core, int sz);
+#line 267 "core.org"
+int sk_core_blkmax(sk_core *core, int sz);
+#line 286 "core.org"
+void sk_core_klerp(sk_core *core, int klerp);
+#line 312 "core.org"
+int sk_core_threads(sk_core *core, int nthreads);
+#line 333 "core.org"
+int sk_core_optimize(sk_core *core);
+#line 360 "core.org"
+int sk_core_arena(sk_core *core, unsigned long size);
+#line 389 "core.org"
+int sk_core_profile(sk_core *core, int on);
+void sk_core_tag(sk_core *core, const char *tag);
+int sk_core_profdump(sk_core *core, const char *filename);
+#line 428 "core.org"
+sk_stack* sk_core_stack(sk_core *core);
+#line 441 "core.org"
+sk_dict* sk_core_dict(sk_core *core);
+#line 456 "core.org"
+void sk_core_srate_set(sk_core *core, int sr);
+#line 493 "core.org"
+void sk_stacklet_init(sk_stacklet *s);
+#line 508 "core.org"
+SKFLT sk_stacklet_constant(sk_stacklet *s);
+void * sk_stacklet_userdata(sk_stacklet *s);
+#line 552 "core.org"
+void sk_stack_init(sk_stack *s);
+#line 597 "core.org"
+int sk_stacklet_isnone(sk_stacklet *s);
+int sk_stacklet_isconstant(sk_stacklet *s);
+int sk_stacklet_iscable(sk_stacklet *s);
+int sk_stacklet_istable(sk_stacklet *s);
+int sk_stacklet_isgeneric(sk_stacklet *s);
+#line 644 "core.org"
+int sk_stack_pop(sk_stack *stack, sk_stacklet **out);
+int sk_stack_push(sk_stack *stack, sk_stacklet **out);
+#line 688 "core.org"
+int sk_stack_peak(sk_stack *stack, sk_stacklet **out);
+#line 713 "core.org"
+int sk_stack_dup(sk_stack *stack, sk_stacklet **out);
+#line 757 "core.org"
+int sk_core_dup(sk_core *core);
+#line 789 "core.org"
+int sk_stack_drop(sk_stack *stack, sk_stacklet **out);
+#line 814 "core.org"
+int sk_core_drop(sk_core *core);
+#line 844 "core.org"
+int sk_stack_swap(sk_stack *stack,
+                  sk_stacklet **s1,
+                  sk_stacklet **s2);
+#line 882 "core.org"
+int sk_core_swap(sk_core *core);
+#line 907 "core.org"
+int sk_core_stackpos(sk_core *core);
+#line 925 "core.org"
+int sk_core_bufpeak(sk_core *core);
+int sk_core_stkpeak(sk_core *core);
+#line 966 "core.org"
+gf_cable* sk_param_cable(sk_param *p);
+SKFLT sk_param_constant(sk_param *p);
+#line 987 "core.org"
+int sk_param_get(sk_core *core, sk_param *p);
+#line 1030 "core.org"
+int sk_param_get_constant(sk_core *core, SKFLT *val);
+#line 1061 "core.org"
+int sk_param_get_cable(sk_core *core, sk_param *p);
+#line 1094 "core.org"
+int sk_param_set(sk_core *core,
+                 gf_node *node,
+                 sk_param *p,
+                 int cid);
+#line 1132 "core.org"
+int sk_core_constant(sk_core *core, SKFLT x);
+#line 1160 "core.org"
+int sk_param_out(sk_core *core,
+                 gf_node *node,
+                 int cid);
+#line 1215 "core.org"
+int sk_core_generic_push(sk_core *core, void *ptr);
+int sk_core_generic_pop(sk_core *core, void **ptr);
+#line 1263 "core.org"
+int sk_param_isconstant(sk_param *p);
+int sk_param_iscable(sk_param *p);
+#line 1315 "core.org"
+void sk_register_entry_init(sk_register_entry *e);
+#line 1349 "core.org"
+void sk_regtbl_init(sk_regtbl *rs);
+#line 1375 "core.org"
+int sk_core_regget(sk_core *core, int pos);
+int sk_register_get(sk_regtbl *rt, int pos, sk_stacklet *s);
+int sk_core_regset(sk_core *core, int pos);
+int sk_register_set(sk_regtbl *rt, int pos, sk_stacklet *s);
+#line 1455 "core.org"
+int sk_core_regmrk(sk_core *core, int pos);
+int sk_register_mark(sk_regtbl *rt, int pos);
+#line 1484 "core.org"
+int sk_core_regclr(sk_core *core, int pos);
+int sk_register_clear(sk_regtbl *rt, int pos);
+#line 1515 "core.org"
+int sk_core_regnxt(sk_core *core, int start, int *pos);
+int sk_register_nxtfree(sk_regtbl *rt, int start);
+#line 1629 "core.org"
+void sk_pqueue_init(sk_pqueue *q);
+#line 1655 "core.org"
+int sk_core_live(sk_core *core, SKFLT init, sk_live **out);
+#line 1753 "core.org"
+int sk_core_live_reg(sk_core *core, int reg, sk_live **live);
+int sk_core_live_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_live *live);
+int sk_core_live_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_live **live);
+#line 1827 "core.org"
+unsigned long sk_core_time(sk_core *core);
+#line 1848 "core.org"
+int sk_core_pqpush(sk_core *core,
+                   sk_live *live,
+                   unsigned long time,
+                   SKFLT val);
+#line 1976 "core.org"
+void sk_evqueue_init(sk_evqueue *q);
+#line 2022 "core.org"
+int sk_core_event(sk_core *core,
+                  unsigned long time,
+                  void (*fn)(sk_core *, void *),
+                  void (*del)(void *),
+                  void *ud);
+#line 2215 "core.org"
+int sk_core_poly(sk_core *core,
+                 int nvoices,
+                 int (*voice)(sk_core *, void *),
+                 void *ud,
+                 sk_poly **out);
+int sk_core_voice(sk_core *core, int ctl);
+#line 2668 "core.org"
+int sk_core_poly_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_poly *poly);
+int sk_core_poly_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_poly **poly);
+#line 2724 "core.org"
+int sk_poly_noteon(sk_poly *poly,
+                   unsigned long time,
+                   SKFLT note,
+                   SKFLT vel);
+int sk_poly_noteoff(sk_poly *poly, unsigned long time, SKFLT note);
+#line 2777 "core.org"
+int sk_poly_active(sk_poly *poly);
+#line 2850 "core.org"
+sk_swap * sk_swap_new(int blksize, int fade);
+void sk_swap_del(sk_swap *swap);
+#line 2907 "core.org"
+int sk_swap_submit(sk_swap *swap, sk_core *core);
+#line 2943 "core.org"
+int sk_swap_collect(sk_swap *swap);
+#line 2981 "core.org"
+void sk_swap_compute(sk_swap *swap, SKFLT *out);
+#line 3079 "core.org"
+void sk_swap_latency(sk_swap *swap,
+                     unsigned long *last,
+                     unsigned long *max);
+#line 3117 "core.org"
+int sk_core_swapper(sk_core *core, sk_swap *swap);
+int sk_core_swap_append(sk_core *core,
+                        const char *key,
+                        int sz,
+                        sk_swap *swap);
+int sk_core_swap_find(sk_core *core,
+                      const char *key,
+                      int sz,
+                      sk_swap **swap);
+#line 3271 "core.org"
+int sk_core_hold(sk_core *core);
+int sk_core_unhold(sk_core *core);
+#line 3352 "core.org"
+int sk_core_table_new(sk_core *core, unsigned long sz);
+int sk_core_table_init(sk_core *core, SKFLT *tab, unsigned long sz);
+#line 3393 "core.org"
+void sk_table_init(sk_table *tab, SKFLT *data, unsigned long sz);
+#line 3409 "core.org"
+size_t sk_table_size(sk_table *t);
+SKFLT* sk_table_data(sk_table *t);
+#line 3430 "core.org"
+int sk_core_table_push(sk_core *core, sk_table *tab);
+int sk_core_table_pop(sk_core *core, sk_table **tab);
+#line 3482 "core.org"
+int sk_table_dump(sk_table *tab, const char *filename);
+int sk_core_tabdump(sk_core *core, const char *filename);
+#line 3531 "core.org"
+int sk_core_tabload(sk_core *core, const char *filename);
+#line 3590 "core.org"
+void sk_core_srand(sk_core *core, unsigned long val);
+#line 3605 "core.org"
+unsigned long sk_core_rand(sk_core *core);
+#line 3628 "core.org"
+SKFLT sk_core_randf(sk_core *core);
+#line 3679 "core.org"
+size_t sk_dict_sizeof(void);
+#line 3718 "core.org"
+void sk_dict_init(sk_dict *d);
+#line 3737 "core.org"
+int sk_dict_clean(sk_dict *d);
+#line 3773 "core.org"
+int sk_dict_append(sk_dict *d,
+                   const char *key,
+                   int sz,
+                   void *p,
+                   void (*del)(void*));
+
+int sk_dict_sappend(sk_dict *d,
+                    const char *key,
+                    int sz,
+                    void *p,
+                    void (*del)(void*),
+                    sk_stacklet **s);
+#line 3847 "core.org"
+int sk_core_append(sk_core *core,
+                   const char *key,
+                   int sz,
+                   void *p,
+                   void (*del)(void*));
+#line 3868 "core.org"
+int sk_dict_lookup_stacklet(sk_dict *d,
+                            const char *key,
+                            int sz,
+                            sk_stacklet **s);
+
+int sk_dict_lookup(sk_dict *d,
+                   const char *key,
+                   int sz,
+                   void **p);
+#line 3929 "core.org"
+int sk_core_lookup(sk_core *core,
+                   const char *key,
+                   int sz,
+                   void **p);
+#line 3948 "core.org"
+int sk_dict_remove(sk_dict *d, const char *key, int sz);
+#line 3989 "core.org"
+int sk_core_remove(sk_core *core,
+                   const char *key,
+                   int sz);
+#line 4006 "core.org"
+int sk_core_grab(sk_core *core,
+                 const char *key,
+                 int sz);
+#line 4046 "core.org"
+int sk_core_append_table(sk_core *core,
+                         const char *key,
+                         int sz,
+                         int tabsz);
+#line 4108 "core.org"
+int sk_core_share_tables(sk_core *dst, sk_core *src);
+#line 32 "core.org"
+
+#ifdef __plan9__
+#pragma incomplete sk_core
+#pragma incomplete sk_stack
+#pragma incomplete sk_regtbl
+#pragma incomplete sk_table
+#endif
+#endif
@@ -0,0 +1,11 @@
+#line 20 "bezier.org"
+#ifndef SK_BEZIER_H
+#define SK_BEZIER_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 144 "bezier.org"
+SKFLT sk_bezier_tick(SKFLT xpos, SKFLT cx, SKFLT cy);
+#line 27 "bezier.org"
+#endif
@@ -0,0 +1,740 @@
+#line 93 "bigverb.org"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#define SK_BIGVERB_PRIV
+#include "bigverb.h"
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#line 56 "bigverb.org"
+struct bigverb_paramset {
+    int delay; /* in samples, 44.1 kHz */
+    int drift; /* 1/10 milliseconds */
+    int randfreq; /* Hertz * 1000 */
+    int seed;
+};
+
+static const struct bigverb_paramset params[8] = {
+    {0x09a9, 0x0a, 0xc1c, 0x07ae},
+    {0x0acf, 0x0b, 0xdac, 0x7333},
+    {0x0c91, 0x11, 0x456, 0x5999},
+    {0x0de5, 0x06, 0xf85, 0x2666},
+    {0x0f43, 0x0a, 0x925, 0x50a3},
+    {0x101f, 0x0b, 0x769, 0x5999},
+    {0x085f, 0x11, 0x37b, 0x7333},
+    {0x078d, 0x06, 0xc95, 0x3851}
+};
+#line 93 "bigverb.org"
+#line 1385 "bigverb.org"
+#define FRACSCALE 0x10000000
+#line 1395 "bigverb.org"
+#define FRACMASK 0xFFFFFFF
+#line 1403 "bigverb.org"
+#define FRACNBITS 28
+#line 93 "bigverb.org"
+#line 532 "bigverb.org"
+static void bank_compute(sk_bigverb *bv,
+                         int n,
+                         const SKFLT *size,
+                         const SKFLT *cutoff,
+                         const SKFLT *inL,
+                         const SKFLT *inR,
+                         SKFLT *outL,
+                         SKFLT *outR);
+#line 584 "bigverb.org"
+static void delay_gather(sk_bigverb *bv, int lane, int n);
+#line 662 "bigverb.org"
+static void bank_interpolate(sk_bigverb *bv, int n);
+#line 705 "bigverb.org"
+static void bank_feedback(sk_bigverb *bv,
+                          int n,
+                          const SKFLT *size,
+                          const SKFLT *cutoff,
+                          const SKFLT *inL,
+                          const SKFLT *inR,
+                          SKFLT *outL,
+                          SKFLT *outR);
+#line 815 "bigverb.org"
+static void delay_write(sk_bigverb *bv, int lane, int wpos, int n);
+#line 965 "bigverb.org"
+static int get_delay_size(const struct bigverb_paramset *p, int sr);
+#line 1042 "bigverb.org"
+static void delay_init(sk_bigverb_delay *d,
+                       const struct bigverb_paramset *p,
+                       SKFLT *buf,
+                       size_t sz,
+                       int sr);
+#line 1150 "bigverb.org"
+static SKFLT delay_compute(sk_bigverb_delay *d,
+                           SKFLT in,
+                           SKFLT fdbk,
+                           SKFLT filt,
+                           int sr);
+#line 1430 "bigverb.org"
+static void generate_next_line(sk_bigverb_delay *d, int sr);
+#line 93 "bigverb.org"
+#line 152 "bigverb.org"
+sk_bigverb * sk_bigverb_new(int sr)
+{
+    sk_bigverb *bv;
+
+    bv = calloc(1, sizeof(sk_bigverb));
+
+    bv->sr = sr;
+#line 212 "bigverb.org"
+sk_bigverb_size(bv, 0.93f);
+#line 238 "bigverb.org"
+sk_bigverb_cutoff(bv, 10000.0);
+#line 257 "bigverb.org"
+bv->pcutoff = -1;
+#line 277 "bigverb.org"
+bv->filt = 1.0;
+#line 933 "bigverb.org"
+bv->buf = NULL;
+#line 152 "bigverb.org"
+#line 938 "bigverb.org"
+{
+unsigned long total_size;
+int i;
+SKFLT *buf;
+
+total_size = 0;
+buf = NULL;
+#line 980 "bigverb.org"
+for (i = 0; i < 8; i++) {
+    total_size += get_delay_size(&params[i], sr);
+}
+#line 938 "bigverb.org"
+#line 991 "bigverb.org"
+buf = calloc(1, sizeof(SKFLT) * total_size);
+bv->buf = buf;
+#line 938 "bigverb.org"
+#line 1007 "bigverb.org"
+{
+    unsigned long bufpos;
+    bufpos = 0;
+    for (i = 0; i < 8; i++) {
+        unsigned int sz;
+        sz = get_delay_size(&params[i], sr);
+
+        delay_init(&bv->delay[i], &params[i],
+                   &buf[bufpos], sz, sr);
+        bufpos += sz;
+    }
+}
+#line 948 "bigverb.org"
+}
+#line 152 "bigverb.org"
+#line 514 "bigverb.org"
+{
+    int i;
+    int mindel;
+
+    bv->chunk = SK_BIGVERB_CHUNK;
+
+    for (i = 0; i < 8; i++) {
+        mindel = (int) floor((params[i].delay / 44100.0 -
+                              params[i].drift * 0.0001) * sr) - 4;
+        if (mindel < bv->chunk) bv->chunk = mindel;
+    }
+
+    if (bv->chunk < 1) bv->chunk = 1;
+}
+#line 162 "bigverb.org"
+
+    return bv;
+}
+#line 177 "bigverb.org"
+void sk_bigverb_del(sk_bigverb *bv)
+{
+#line 997 "bigverb.org"
+free(bv->buf);
+#line 180 "bigverb.org"
+    free(bv);
+    bv = NULL;
+}
+#line 217 "bigverb.org"
+void sk_bigverb_size(sk_bigverb *bv, SKFLT size)
+{
+    bv->size = size;
+}
+#line 262 "bigverb.org"
+void sk_bigverb_cutoff(sk_bigverb *bv, SKFLT cutoff)
+{
+    bv->cutoff = cutoff;
+}
+#line 301 "bigverb.org"
+void sk_bigverb_tick(sk_bigverb *bv,
+                     SKFLT inL, SKFLT inR,
+                     SKFLT *outL, SKFLT *outR)
+{
+    SKFLT lsum, rsum;
+
+    lsum = 0;
+    rsum = 0;
+
+#line 860 "bigverb.org"
+if (bv->pcutoff != bv->cutoff) {
+    bv->pcutoff = bv->cutoff;
+    bv->filt = (SKFLT) (2.0 - cos(bv->pcutoff * 2 * M_PI / bv->sr));
+    bv->filt = (SKFLT) (bv->filt - sqrt(bv->filt * bv->filt - 1.0));
+}
+#line 301 "bigverb.org"
+#line 875 "bigverb.org"
+{
+    int i;
+    SKFLT jp;
+
+    jp = 0;
+
+    for (i = 0; i < 8; i++) {
+        jp += bv->delay[i].y;
+    }
+
+    jp *= 0.25;
+
+    inL = jp + inL;
+    inR = jp + inR;
+}
+#line 301 "bigverb.org"
+#line 901 "bigverb.org"
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        if (i & 1) {
+            rsum += delay_compute(&bv->delay[i],
+                                  inR,
+                                  bv->size,
+                                  bv->filt,
+                                  bv->sr);
+        } else {
+            lsum += delay_compute(&bv->delay[i],
+                                  inL,
+                                  bv->size,
+                                  bv->filt,
+                                  bv->sr);
+        }
+    }
+}
+rsum *= 0.35f;
+lsum *= 0.35f;
+#line 313 "bigverb.org"
+
+    *outL = lsum;
+    *outR = rsum;
+}
+#line 348 "bigverb.org"
+void sk_bigverb_compute(sk_bigverb *bv,
+                        int n,
+                        const SKFLT *size,
+                        const SKFLT *cutoff,
+                        const SKFLT *inL,
+                        const SKFLT *inR,
+                        SKFLT *outL,
+                        SKFLT *outR)
+{
+    int len;
+
+    while (n > 0) {
+        len = n < bv->chunk ? n : bv->chunk;
+
+        bank_compute(bv, len, size, cutoff, inL, inR, outL, outR);
+
+        if (size != NULL) size += len;
+        if (cutoff != NULL) cutoff += len;
+        inL += len;
+        inR += len;
+        outL += len;
+        outR += len;
+        n -= len;
+    }
+}
+#line 397 "bigverb.org"
+void sk_bigverb_skip(sk_bigverb *bv, int n)
+{
+    sk_bigverb_delay *del;
+    int sz;
+    int wpos, irpos, frpos, inc;
+    int i, t, end, run;
+
+    for (i = 0; i < 8; i++) {
+        del = &bv->delay[i];
+        sz = (int) del->sz;
+        t = 0;
+
+        while (t < n) {
+            run = del->counter < 1 ? 1 : del->counter;
+            end = t + run < n ? t + run : n;
+            run = end - t;
+
+            wpos = del->wpos;
+            irpos = del->irpos;
+            frpos = del->frpos;
+            inc = del->inc;
+
+            for (; t < end; t++) {
+                wpos++;
+                if (wpos >= sz) wpos -= sz;
+
+                if (frpos >= FRACSCALE) {
+                    irpos += frpos >> FRACNBITS;
+                    frpos &= FRACMASK;
+                }
+
+                if (irpos >= sz) irpos -= sz;
+
+                frpos += inc;
+            }
+
+            del->wpos = wpos;
+            del->irpos = irpos;
+            del->frpos = frpos;
+            del->counter -= run;
+
+            if (del->counter <= 0) generate_next_line(del, bv->sr);
+        }
+    }
+}
+#line 544 "bigverb.org"
+static void bank_compute(sk_bigverb *bv,
+                         int n,
+                         const SKFLT *size,
+                         const SKFLT *cutoff,
+                         const SKFLT *inL,
+                         const SKFLT *inR,
+                         SKFLT *outL,
+                         SKFLT *outR)
+{
+    int i;
+    int wpos[8];
+
+    for (i = 0; i < 8; i++) {
+        wpos[i] = bv->delay[i].wpos;
+        delay_gather(bv, i, n);
+    }
+
+    bank_interpolate(bv, n);
+    bank_feedback(bv, n, size, cutoff, inL, inR, outL, outR);
+
+    for (i = 0; i < 8; i++) {
+        delay_write(bv, i, wpos[i], n);
+    }
+}
+#line 589 "bigverb.org"
+static void delay_gather(sk_bigverb *bv, int lane, int n)
+{
+    sk_bigverb_delay *del;
+    const SKFLT *x;
+    int sz;
+    int wpos, irpos, frpos, inc;
+    int t, end, run;
+    int j, k;
+
+    del = &bv->delay[lane];
+    x = del->buf;
+    sz = (int) del->sz;
+    t = 0;
+
+    while (t < n) {
+        run = del->counter < 1 ? 1 : del->counter;
+        end = t + run < n ? t + run : n;
+        run = end - t;
+
+        wpos = del->wpos;
+        irpos = del->irpos;
+        frpos = del->frpos;
+        inc = del->inc;
+
+        for (; t < end; t++) {
+            wpos++;
+            if (wpos >= sz) wpos -= sz;
+
+            if (frpos >= FRACSCALE) {
+                irpos += frpos >> FRACNBITS;
+                frpos &= FRACMASK;
+            }
+
+            if (irpos >= sz) irpos -= sz;
+
+            j = t * 8 + lane;
+            bv->frac[j] = frpos / (SKFLT)FRACSCALE;
+
+            if (irpos > 0 && irpos < sz - 2) {
+                bv->tap[0][j] = x[irpos - 1];
+                bv->tap[1][j] = x[irpos];
+                bv->tap[2][j] = x[irpos + 1];
+                bv->tap[3][j] = x[irpos + 2];
+            } else {
+                k = irpos - 1;
+                if (k < 0) k += sz;
+                bv->tap[0][j] = x[k];
+                k++; if (k >= sz) k -= sz;
+                bv->tap[1][j] = x[k];
+                k++; if (k >= sz) k -= sz;
+                bv->tap[2][j] = x[k];
+                k++; if (k >= sz) k -= sz;
+                bv->tap[3][j] = x[k];
+            }
+
+            frpos += inc;
+        }
+
+        del->wpos = wpos;
+        del->irpos = irpos;
+        del->frpos = frpos;
+        del->counter -= run;
+
+        if (del->counter <= 0) generate_next_line(del, bv->sr);
+    }
+}
+#line 667 "bigverb.org"
+static void bank_interpolate(sk_bigverb *bv, int n)
+{
+    int j;
+    SKFLT frac_norm;
+    SKFLT a, b, c, d;
+    SKFLT s[4];
+    SKFLT out;
+
+    for (j = 0; j < n * 8; j++) {
+        frac_norm = bv->frac[j];
+        s[0] = bv->tap[0][j];
+        s[1] = bv->tap[1][j];
+        s[2] = bv->tap[2][j];
+        s[3] = bv->tap[3][j];
+#line 1249 "bigverb.org"
+{
+    SKFLT tmp[2];
+    d = (SKFLT) (((frac_norm * frac_norm) - 1) / 6.0);
+    tmp[0] = (SKFLT) ((frac_norm + 1.0) * 0.5);
+    tmp[1] = 3.0f * d;
+    a = tmp[0] - 1.0f - d;
+    c = tmp[0] - tmp[1];
+    b = tmp[1] - frac_norm;
+}
+#line 667 "bigverb.org"
+#line 1306 "bigverb.org"
+out = (a*s[0] + b*s[1] + c*s[2] + d*s[3]) * frac_norm + s[1];
+#line 683 "bigverb.org"
+        bv->rd[j] = out;
+    }
+}
+#line 717 "bigverb.org"
+static void bank_feedback(sk_bigverb *bv,
+                          int n,
+                          const SKFLT *size,
+                          const SKFLT *cutoff,
+                          const SKFLT *inL,
+                          const SKFLT *inR,
+                          SKFLT *outL,
+                          SKFLT *outR)
+{
+    int t, i;
+    SKFLT y[8];
+    SKFLT jp;
+    SKFLT l, r;
+    SKFLT lsum, rsum;
+    SKFLT fdbk, filt;
+    SKFLT out;
+    const SKFLT *rd;
+    SKFLT *wr;
+    int ss, cs;
+
+    for (i = 0; i < 8; i++) y[i] = bv->delay[i].y;
+
+    if (size == NULL && cutoff == NULL) {
+#line 860 "bigverb.org"
+if (bv->pcutoff != bv->cutoff) {
+    bv->pcutoff = bv->cutoff;
+    bv->filt = (SKFLT) (2.0 - cos(bv->pcutoff * 2 * M_PI / bv->sr));
+    bv->filt = (SKFLT) (bv->filt - sqrt(bv->filt * bv->filt - 1.0));
+}
+#line 741 "bigverb.org"
+        fdbk = bv->size;
+        filt = bv->filt;
+
+        for (t = 0; t < n; t++) {
+#line 774 "bigverb.org"
+rd = bv->rd + t * 8;
+wr = bv->wr + t * 8;
+
+jp = 0;
+for (i = 0; i < 8; i++) jp += y[i];
+jp *= 0.25;
+
+l = jp + inL[t];
+r = jp + inR[t];
+
+for (i = 0; i < 8; i += 2) {
+    wr[i] = l - y[i];
+    wr[i + 1] = r - y[i + 1];
+}
+
+for (i = 0; i < 8; i++) {
+    out = rd[i];
+    out *= fdbk;
+    out += (y[i] - out) * filt;
+    y[i] = out;
+}
+
+lsum = 0;
+rsum = 0;
+
+for (i = 0; i < 8; i += 2) {
+    lsum += y[i];
+    rsum += y[i + 1];
+}
+
+outL[t] = lsum * 0.35f;
+outR[t] = rsum * 0.35f;
+#line 746 "bigverb.org"
+        }
+
+        for (i = 0; i < 8; i++) bv->delay[i].y = y[i];
+        return;
+    }
+
+    ss = cs = 1;
+    if (size == NULL) {size = &bv->size; ss = 0;}
+    if (cutoff == NULL) {cutoff = &bv->cutoff; cs = 0;}
+
+    for (t = 0; t < n; t++) {
+        sk_bigverb_size(bv, size[t * ss]);
+        sk_bigverb_cutoff(bv, cutoff[t * cs]);
+#line 860 "bigverb.org"
+if (bv->pcutoff != bv->cutoff) {
+    bv->pcutoff = bv->cutoff;
+    bv->filt = (SKFLT) (2.0 - cos(bv->pcutoff * 2 * M_PI / bv->sr));
+    bv->filt = (SKFLT) (bv->filt - sqrt(bv->filt * bv->filt - 1.0));
+}
+#line 760 "bigverb.org"
+        fdbk = bv->size;
+        filt = bv->filt;
+#line 774 "bigverb.org"
+rd = bv->rd + t * 8;
+wr = bv->wr + t * 8;
+
+jp = 0;
+for (i = 0; i < 8; i++) jp += y[i];
+jp *= 0.25;
+
+l = jp + inL[t];
+r = jp + inR[t];
+
+for (i = 0; i < 8; i += 2) {
+    wr[i] = l - y[i];
+    wr[i + 1] = r - y[i + 1];
+}
+
+for (i = 0; i < 8; i++) {
+    out = rd[i];
+    out *= fdbk;
+    out += (y[i] - out) * filt;
+    y[i] = out;
+}
+
+lsum = 0;
+rsum = 0;
+
+for (i = 0; i < 8; i += 2) {
+    lsum += y[i];
+    rsum += y[i + 1];
+}
+
+outL[t] = lsum * 0.35f;
+outR[t] = rsum * 0.35f;
+#line 763 "bigverb.org"
+    }
+
+    for (i = 0; i < 8; i++) bv->delay[i].y = y[i];
+}
+#line 820 "bigverb.org"
+static void delay_write(sk_bigverb *bv, int lane, int wpos, int n)
+{
+    sk_bigverb_delay *del;
+    SKFLT *buf;
+    const SKFLT *wr;
+    int t, len;
+    int k;
+
+    del = &bv->delay[lane];
+    buf = del->buf;
+    wr = bv->wr + lane;
+    t = 0;
+
+    while (t < n) {
+        len = (int) del->sz - wpos;
+        if (len > n - t) len = n - t;
+
+        for (k = 0; k < len; k++) buf[wpos + k] = wr[(t + k) * 8];
+
+        t += len;
+        wpos += len;
+        if (wpos >= del->sz) wpos = 0;
+    }
+}
+#line 970 "bigverb.org"
+static int get_delay_size(const struct bigverb_paramset *p, int sr)
+{
+    SKFLT sz;
+    sz = (SKFLT) (p->delay/44100.0 + (p->drift * 0.0001) * 1.125);
+    return (int) floor(16 + sz*sr);
+}
+#line 1051 "bigverb.org"
+static void delay_init(sk_bigverb_delay *d,
+                       const struct bigverb_paramset *p,
+                       SKFLT *buf,
+                       size_t sz,
+                       int sr)
+{
+    SKFLT readpos;
+#line 1072 "bigverb.org"
+d->buf = buf;
+d->sz = sz;
+#line 1085 "bigverb.org"
+d->wpos = 0;
+#line 1109 "bigverb.org"
+d->rng = p->seed;
+#line 1123 "bigverb.org"
+readpos = ((SKFLT)p->delay / 44100);
+readpos += (SKFLT) (d->rng * (p->drift * 0.0001) / 32768.0);
+readpos = sz - (readpos * sr);
+d->irpos = (int) floor(readpos);
+d->frpos = (int) floor((readpos - d->irpos) * FRACSCALE);
+#line 1109 "bigverb.org"
+#line 1123 "bigverb.org"
+#line 1420 "bigverb.org"
+d->inc = 0;
+d->counter = 0;
+#line 1476 "bigverb.org"
+d->maxcount = (int) floor((sr / ((SKFLT)p->randfreq * 0.001)));
+#line 1514 "bigverb.org"
+d->dels = (SKFLT) (p->delay / 44100.0);
+#line 1524 "bigverb.org"
+d->drift = (SKFLT) p->drift;
+#line 1135 "bigverb.org"
+generate_next_line(d, sr);
+#line 1575 "bigverb.org"
+d->y = 0.0;
+#line 1059 "bigverb.org"
+}
+#line 1159 "bigverb.org"
+static SKFLT delay_compute(sk_bigverb_delay *del,
+                           SKFLT in,
+                           SKFLT fdbk,
+                           SKFLT filt,
+                           int sr)
+{
+    SKFLT out;
+    SKFLT frac_norm;
+    SKFLT a, b, c, d;
+    SKFLT s[4];
+    out = 0;
+#line 1197 "bigverb.org"
+del->buf[del->wpos] = in - del->y;
+#line 1159 "bigverb.org"
+#line 1205 "bigverb.org"
+del->wpos++;
+if (del->wpos >= del->sz) del->wpos -= (int) del->sz;
+#line 1159 "bigverb.org"
+#line 1217 "bigverb.org"
+if (del->frpos >= FRACSCALE) {
+    del->irpos += del->frpos >> FRACNBITS;
+    del->frpos &= FRACMASK;
+}
+#line 1159 "bigverb.org"
+#line 1227 "bigverb.org"
+if (del->irpos >= del->sz) del->irpos -= (int) del->sz;
+#line 1159 "bigverb.org"
+#line 1236 "bigverb.org"
+frac_norm = del->frpos / (SKFLT)FRACSCALE;
+#line 1159 "bigverb.org"
+#line 1249 "bigverb.org"
+{
+    SKFLT tmp[2];
+    d = (SKFLT) (((frac_norm * frac_norm) - 1) / 6.0);
+    tmp[0] = (SKFLT) ((frac_norm + 1.0) * 0.5);
+    tmp[1] = 3.0f * d;
+    a = tmp[0] - 1.0f - d;
+    c = tmp[0] - tmp[1];
+    b = tmp[1] - frac_norm;
+}
+#line 1159 "bigverb.org"
+#line 1268 "bigverb.org"
+{
+    int n;
+    SKFLT *x;
+    n = del->irpos;
+    x = del->buf;
+
+    if (n > 0 && n < (del->sz - 2)) {
+        s[0] = x[n - 1];
+        s[1] = x[n];
+        s[2] = x[n + 1];
+        s[3] = x[n + 2];
+    } else {
+        int k;
+        n--;
+        if (n < 0) n += (int) del->sz;
+        s[0] = x[n];
+        for (k = 0; k < 3; k++) {
+            n++;
+            if (n >= del->sz) n -= (int) del->sz;
+            s[k + 1] = x[n];
+        }
+    }
+}
+#line 1159 "bigverb.org"
+#line 1306 "bigverb.org"
+out = (a*s[0] + b*s[1] + c*s[2] + d*s[3]) * frac_norm + s[1];
+#line 1159 "bigverb.org"
+#line 1314 "bigverb.org"
+del->frpos += del->inc;
+#line 1159 "bigverb.org"
+#line 1324 "bigverb.org"
+out *= fdbk;
+out += (del->y - out) * filt;
+del->y = out;
+#line 1159 "bigverb.org"
+#line 1351 "bigverb.org"
+del->counter--;
+if (del->counter <= 0) {
+    generate_next_line(del, sr);
+}
+#line 1181 "bigverb.org"
+    return out;
+}
+#line 1549 "bigverb.org"
+static void generate_next_line(sk_bigverb_delay *d, int sr)
+{
+    SKFLT curdel;
+    SKFLT nxtdel;
+    SKFLT inc;
+#line 1451 "bigverb.org"
+if (d->rng < 0) d->rng += 0x10000;
+/* 5^6 = 15625 */
+d->rng = (1 + d->rng * 0x3d09);
+d->rng &= 0xFFFF;
+if (d->rng >= 0x8000) d->rng -= 0x10000;
+#line 1549 "bigverb.org"
+#line 1481 "bigverb.org"
+d->counter = d->maxcount;
+#line 1549 "bigverb.org"
+#line 1491 "bigverb.org"
+curdel = d->wpos -
+    (d->irpos + (d->frpos/(SKFLT)FRACSCALE));
+while (curdel < 0) curdel += d->sz;
+curdel /= sr;
+#line 1502 "bigverb.org"
+nxtdel = (SKFLT) (d->rng * (d->drift * 0.0001) / 32768.0) + d->dels;
+#line 1549 "bigverb.org"
+#line 1535 "bigverb.org"
+inc = ((curdel - nxtdel) / (SKFLT)d->counter)*sr;
+inc += 1;
+#line 1549 "bigverb.org"
+#line 1544 "bigverb.org"
+d->inc = (int) floor(inc * FRACSCALE);
+#line 1559 "bigverb.org"
+}
+#line 93 "bigverb.org"
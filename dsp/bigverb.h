@@ -0,0 +1,92 @@
+#line 109 "bigverb.org"
+#ifndef SK_BIGVERB_H
+#define SK_BIGVERB_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 129 "bigverb.org"
+typedef struct sk_bigverb sk_bigverb;
+#line 1030 "bigverb.org"
+typedef struct sk_bigverb_delay sk_bigverb_delay;
+#line 109 "bigverb.org"
+#line 147 "bigverb.org"
+sk_bigverb * sk_bigverb_new(int sr);
+#line 172 "bigverb.org"
+void sk_bigverb_del(sk_bigverb *bv);
+#line 195 "bigverb.org"
+void sk_bigverb_size(sk_bigverb *bv, SKFLT size);
+#line 227 "bigverb.org"
+void sk_bigverb_cutoff(sk_bigverb *bv, SKFLT cutoff);
+#line 294 "bigverb.org"
+void sk_bigverb_tick(sk_bigverb *bv,
+                     SKFLT inL, SKFLT inR,
+                     SKFLT *outL, SKFLT *outR);
+#line 330 "bigverb.org"
+void sk_bigverb_compute(sk_bigverb *bv,
+                        int n,
+                        const SKFLT *size,
+                        const SKFLT *cutoff,
+                        const SKFLT *inL,
+                        const SKFLT *inR,
+                        SKFLT *outL,
+                        SKFLT *outR);
+#line 389 "bigverb.org"
+void sk_bigverb_skip(sk_bigverb *bv, int n);
+#line 117 "bigverb.org"
+
+#ifdef SK_BIGVERB_PRIV
+#line 493 "bigverb.org"
+#define SK_BIGVERB_CHUNK 64
+#line 117 "bigverb.org"
+#line 129 "bigverb.org"
+#line 1035 "bigverb.org"
+struct sk_bigverb_delay {
+#line 1066 "bigverb.org"
+SKFLT *buf;
+size_t sz;
+#line 1080 "bigverb.org"
+int wpos;
+#line 1095 "bigverb.org"
+int irpos;
+int frpos;
+#line 1104 "bigverb.org"
+int rng;
+#line 1414 "bigverb.org"
+int inc;
+int counter;
+#line 1466 "bigverb.org"
+int maxcount;
+#line 1509 "bigverb.org"
+SKFLT dels;
+#line 1519 "bigverb.org"
+SKFLT drift;
+#line 1570 "bigverb.org"
+SKFLT y;
+#line 1037 "bigverb.org"
+};
+#line 135 "bigverb.org"
+struct sk_bigverb {
+    int sr;
+#line 207 "bigverb.org"
+SKFLT size;
+#line 251 "bigverb.org"
+SKFLT cutoff;
+SKFLT pcutoff;
+#line 272 "bigverb.org"
+SKFLT filt;
+#line 498 "bigverb.org"
+int chunk;
+SKFLT frac[SK_BIGVERB_CHUNK * 8];
+SKFLT tap[4][SK_BIGVERB_CHUNK * 8];
+SKFLT rd[SK_BIGVERB_CHUNK * 8];
+SKFLT wr[SK_BIGVERB_CHUNK * 8];
+#line 928 "bigverb.org"
+SKFLT *buf;
+#line 1002 "bigverb.org"
+sk_bigverb_delay delay[8];
+#line 138 "bigverb.org"
+};
+#line 121 "bigverb.org"
+#endif
+#endif
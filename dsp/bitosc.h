@@ -0,0 +1,10 @@
+#line 18 "bitosc.org"
+#ifndef SK_BITOSC_H
+#define SK_BITOSC_H
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 36 "bitosc.org"
+SKFLT sk_bitosc_tick(SKFLT phs, unsigned long wt, int sz);
+#line 24 "bitosc.org"
+#endif
@@ -0,0 +1,213 @@
+#line 77 "butterworth.org"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define SK_BUTTERWORTH_PRIV
+#include "butterworth.h"
+
+#define ROOT2 1.4142135623730950488
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#line 114 "butterworth.org"
+static SKFLT filter(SKFLT in, SKFLT *a)
+{
+    SKFLT t, y;
+    /* a5 = t(n - 1); a6 = t(n - 2) */
+    t = in - a[3]*a[5] - a[4]*a[6];
+    y = t*a[0] + a[1]*a[5] + a[2]*a[6];
+    a[6] = a[5];
+    a[5] = t;
+    return y;
+}
+
+static void filter_block(int n, const SKFLT *in, SKFLT *out, SKFLT *a)
+{
+    SKFLT a0, a1, a2, a3, a4;
+    SKFLT t1, t2;
+    int i;
+
+    a0 = a[0];
+    a1 = a[1];
+    a2 = a[2];
+    a3 = a[3];
+    a4 = a[4];
+    t1 = a[5];
+    t2 = a[6];
+
+    for (i = 0; i < n; i++) {
+        SKFLT t;
+        t = in[i] - a3*t1 - a4*t2;
+        out[i] = t*a0 + a1*t1 + a2*t2;
+        t2 = t1;
+        t1 = t;
+    }
+
+    a[5] = t1;
+    a[6] = t2;
+}
+
+void sk_butterworth_init(sk_butterworth *bw, int sr)
+{
+    int i;
+    sk_butterworth_freq(bw, 1000.0);
+    sk_butterworth_bandwidth(bw, 1000.0);
+    bw->lfreq = -1;
+    bw->lbw = -1;
+    bw->pidsr = M_PI / (SKFLT)sr;
+    for (i = 0; i < 7; i++) bw->a[i] = 0.0;
+}
+
+void sk_butterworth_freq(sk_butterworth *bw, SKFLT freq)
+{
+    bw->freq = freq;
+}
+
+void sk_butterworth_bandwidth(sk_butterworth *but, SKFLT bw)
+{
+    but->bw = bw;
+}
+#line 77 "butterworth.org"
+#line 176 "butterworth.org"
+static void lp_update(sk_butterworth *bw)
+{
+    if (bw->freq != bw->lfreq) {
+        SKFLT *a, c;
+        a = bw->a;
+        bw->lfreq = bw->freq;
+        /* derive C constant used in BLT */
+        c = 1.0 / tan((SKFLT)(bw->pidsr * bw->lfreq));
+
+        /* perform BLT, store components */
+        a[0] = 1.0 / (1.0 + c*ROOT2 + c*c);
+        a[1] = 2*a[0];
+        a[2] = a[0];
+        a[3] = 2.0 * (1.0 - c*c) * a[0];
+        a[4] = (1.0 - c*ROOT2 + c*c) * a[0];
+    }
+}
+
+SKFLT sk_butlp_tick(sk_butterworth *bw, SKFLT in)
+{
+    lp_update(bw);
+    return filter(in, bw->a);
+}
+#line 203 "butterworth.org"
+static void hp_update(sk_butterworth *bw)
+{
+    if (bw->freq != bw->lfreq) {
+        SKFLT *a, c;
+        a = bw->a;
+        bw->lfreq = bw->freq;
+        /* derive C constant used in BLT */
+        c = tan((SKFLT)(bw->pidsr * bw->freq));
+
+        /* perform BLT, store components */
+        a[0] = 1.0 / (1.0 + c*ROOT2 + c*c);
+        a[1] = -2*a[0];
+        a[2] = a[0];
+        a[3] = 2.0 * (c*c - 1.0) * a[0];
+        a[4] = (1.0 - c*ROOT2 + c*c) * a[0];
+    }
+}
+
+SKFLT sk_buthp_tick(sk_butterworth *bw, SKFLT in)
+{
+    hp_update(bw);
+    return filter(in, bw->a);
+}
+#line 230 "butterworth.org"
+static void bp_update(sk_butterworth *bw)
+{
+    if (bw->bw != bw->lbw || bw->freq != bw->lfreq) {
+        SKFLT *a, c, d;
+        a = bw->a;
+        bw->lfreq = bw->freq;
+        bw->lbw = bw->bw;
+
+        /* Perform BLT and store components */
+        c = 1.0 / tan((SKFLT)(bw->pidsr * bw->bw));
+        d = 2.0 * cos((SKFLT)(2.0*bw->pidsr * bw->freq));
+        a[0] = 1.0 / (1.0 + c);
+        a[1] = 0.0;
+        a[2] = -a[0];
+        a[3] = - c * d * a[0];
+        a[4] = (c - 1.0) * a[0];
+    }
+}
+
+SKFLT sk_butbp_tick(sk_butterworth *bw, SKFLT in)
+{
+    bp_update(bw);
+    return filter(in, bw->a);
+}
+#line 273 "butterworth.org"
+void sk_butlp_compute(sk_butterworth *bw,
+                      int n,
+                      const SKFLT *freq,
+                      const SKFLT *in,
+                      SKFLT *out)
+{
+    int i;
+
+    if (freq == NULL) {
+        lp_update(bw);
+        filter_block(n, in, out, bw->a);
+        return;
+    }
+
+    for (i = 0; i < n; i++) {
+        bw->freq = freq[i];
+        out[i] = sk_butlp_tick(bw, in[i]);
+    }
+}
+
+void sk_buthp_compute(sk_butterworth *bw,
+                      int n,
+                      const SKFLT *freq,
+                      const SKFLT *in,
+                      SKFLT *out)
+{
+    int i;
+
+    if (freq == NULL) {
+        hp_update(bw);
+        filter_block(n, in, out, bw->a);
+        return;
+    }
+
+    for (i = 0; i < n; i++) {
+        bw->freq = freq[i];
+        out[i] = sk_buthp_tick(bw, in[i]);
+    }
+}
+
+void sk_butbp_compute(sk_butterworth *bw,
+                      int n,
+                      const SKFLT *freq,
+                      const SKFLT *bandwidth,
+                      const SKFLT *in,
+                      SKFLT *out)
+{
+    int i;
+    int fs, bs;
+
+    if (freq == NULL && bandwidth == NULL) {
+        bp_update(bw);
+        filter_block(n, in, out, bw->a);
+        return;
+    }
+
+    fs = bs = 1;
+    if (freq == NULL) {freq = &bw->freq; fs = 0;}
+    if (bandwidth == NULL) {bandwidth = &bw->bw; bs = 0;}
+
+    for (i = 0; i < n; i++) {
+        bw->freq = freq[i * fs];
+        bw->bw = bandwidth[i * bs];
+        out[i] = sk_butbp_tick(bw, in[i]);
+    }
+}
+#line 77 "butterworth.org"
@@ -0,0 +1,16 @@
+#line 11 "crossfade.org"
+#ifndef SK_CROSSFADE_H
+#define SK_CROSSFADE_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#line 42 "crossfade.org"
+SKFLT sk_crossfade_linear(SKFLT a, SKFLT b, SKFLT pos);
+#line 57 "crossfade.org"
+SKFLT sk_crossfade_sqrt(SKFLT a, SKFLT b, SKFLT pos);
+#line 72 "crossfade.org"
+SKFLT sk_crossfade_equal(SKFLT a, SKFLT b, SKFLT pos);
+#line 19 "crossfade.org"
+#endif
@@ -0,0 +1,549 @@
+#line 59 "ensemble.org"
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#define SK_ENSEMBLE_PRIV
+#include "ensemble.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#line 310 "ensemble.org"
+static void setup_waveform(sk_ensemble *e, int v);
+#line 412 "ensemble.org"
+static void glottis_time(sk_ensemble *e, int k);
+#line 445 "ensemble.org"
+static void glottis_compute(sk_ensemble *e, int k, SKFLT *g);
+#line 572 "ensemble.org"
+static void shape(sk_ensemble *e, int v);
+#line 659 "ensemble.org"
+static void tract_compute(struct sk_ensemble_group *gp,
+                          const SKFLT *nose_reflection,
+                          const SKFLT *in,
+                          SKFLT *out);
+#line 819 "ensemble.org"
+static void compute_group(sk_ensemble *e, int k, int n, SKFLT *out);
+#line 59 "ensemble.org"
+#line 127 "ensemble.org"
+void sk_ensemble_init(sk_ensemble *e, int sr, int nvoices)
+{
+    int v;
+
+    memset(e, 0, sizeof(sk_ensemble));
+
+    if (nvoices < 1) nvoices = 1;
+    if (nvoices > SK_ENSEMBLE_MAX) nvoices = SK_ENSEMBLE_MAX;
+
+    e->nvoices = nvoices;
+    e->T = 1.0 / sr;
+
+    for (v = 0; v < SK_ENSEMBLE_MAX; v++) {
+        struct sk_ensemble_group *gp;
+        int l;
+
+        gp = &e->grp[v / SK_ENSEMBLE_LANES];
+        l = v % SK_ENSEMBLE_LANES;
+#line 297 "ensemble.org"
+e->freq[v] = 140;
+e->tenseness[v] = 0.6;
+e->time[v] = 0;
+e->rng[v] = 0;
+#line 395 "ensemble.org"
+e->time[v] = e->T;
+setup_waveform(e, v);
+#line 520 "ensemble.org"
+{
+    int i;
+
+    for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+        if (i < 7) gp->diameter[i][l] = 0.6;
+        else if (i < 12) gp->diameter[i][l] = 1.1;
+        else gp->diameter[i][l] = 1.5;
+    }
+}
+
+e->tongue_pos[v] = -1;
+e->tongue_diam[v] = -1;
+e->velum[v] = 0;
+e->ppos[v] = -1;
+e->pdiam[v] = -1;
+e->pvelum[v] = -1;
+e->amp[v] = v < nvoices ? 1 : 0;
+#line 146 "ensemble.org"
+    }
+
+#line 545 "ensemble.org"
+{
+    int i;
+    SKFLT A[SK_ENSEMBLE_NOSE];
+
+    for (i = 0; i < SK_ENSEMBLE_NOSE; i++) {
+        SKFLT d;
+        d = 2 * ((SKFLT)i / SK_ENSEMBLE_NOSE);
+        if (d < 1) d = 0.4 + 1.6 * d;
+        else d = 0.5 + 1.5*(2-d);
+        d = d < 1.9 ? d : 1.9;
+        A[i] = d * d;
+    }
+
+    e->nose_reflection[0] = 0;
+    for (i = 1; i < SK_ENSEMBLE_NOSE; i++) {
+        e->nose_reflection[i] = (A[i - 1] - A[i]) / (A[i - 1] + A[i]);
+    }
+}
+#line 149 "ensemble.org"
+}
+#line 176 "ensemble.org"
+void sk_ensemble_freq(sk_ensemble *e, int v, SKFLT freq)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->freq[v] = freq;
+}
+
+void sk_ensemble_tenseness(sk_ensemble *e, int v, SKFLT tenseness)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->tenseness[v] = tenseness;
+}
+
+void sk_ensemble_tongue(sk_ensemble *e, int v,
+                        SKFLT position, SKFLT diameter)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->tongue_pos[v] = position;
+    e->tongue_diam[v] = diameter;
+}
+
+void sk_ensemble_velum(sk_ensemble *e, int v, SKFLT velum)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->velum[v] = velum;
+}
+
+void sk_ensemble_amp(sk_ensemble *e, int v, SKFLT amp)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->amp[v] = amp;
+}
+
+int sk_ensemble_nvoices(sk_ensemble *e)
+{
+    return e->nvoices;
+}
+#line 288 "ensemble.org"
+void sk_ensemble_seed(sk_ensemble *e, int v, unsigned long seed)
+{
+    if (v < 0 || v >= e->nvoices) return;
+    e->rng[v] = seed & 0x7fffffff;
+}
+#line 315 "ensemble.org"
+static void setup_waveform(sk_ensemble *e, int v)
+{
+    SKFLT Rd, Ra, Rk, Rg;
+    SKFLT Ta, Tp, Te;
+    SKFLT epsilon, shift, delta, rhs_integral;
+    SKFLT lower_integral, upper_integral;
+    SKFLT omega, s, y, z;
+    SKFLT alpha, E0;
+    SKFLT t, dt, mag;
+
+    e->wlen[v] = 1.0 / e->freq[v];
+
+    Rd = 3 * (1 - e->tenseness[v]);
+    if (Rd < 0.5) Rd = 0.5;
+    if (Rd > 2.7) Rd = 2.7;
+
+    Ra = -0.01 + 0.048*Rd;
+    Rk = 0.224 + 0.118*Rd;
+    Rg = (Rk/4)*(0.5 + 1.2*Rk)/(0.11*Rd-Ra*(0.5+1.2*Rk));
+
+    Ta = Ra;
+    Tp = (SKFLT)1.0 / (2*Rg);
+    Te = Tp + Tp*Rk;
+
+    epsilon = (SKFLT)1.0 / Ta;
+    shift = exp(-epsilon * (1 - Te));
+    delta = 1 - shift;
+
+    rhs_integral = (SKFLT)(1.0/epsilon) * (shift-1) + (1-Te)*shift;
+    rhs_integral = rhs_integral / delta;
+    lower_integral = - (Te - Tp) / 2 + rhs_integral;
+    upper_integral = -lower_integral;
+
+    omega = M_PI / Tp;
+    s = sin(omega * Te);
+
+    y = -M_PI * s * upper_integral / (Tp*2);
+    z = log(y);
+    alpha = z / (Tp/2 - Te);
+    E0 = -1 / (s * exp(alpha*Te));
+
+    e->Tw[v] = Te * e->wlen[v];
+    e->shift[v] = shift;
+    e->delta[v] = delta;
+    e->epsilon[v] = epsilon;
+
+#line 372 "ensemble.org"
+t = e->time[v] / e->wlen[v];
+dt = e->T / e->wlen[v];
+
+mag = E0 * exp(alpha * t);
+e->zr[v] = mag * cos(omega * t);
+e->zi[v] = mag * sin(omega * t);
+
+mag = exp(alpha * dt);
+e->dr[v] = mag * cos(omega * dt);
+e->di[v] = mag * sin(omega * dt);
+
+e->phase[v] = 0;
+e->ret[v] = 0;
+e->rstep[v] = exp(-epsilon * dt);
+#line 362 "ensemble.org"
+}
+#line 417 "ensemble.org"
+static void glottis_time(sk_ensemble *e, int k)
+{
+    int v;
+
+    for (v = k; v < k + SK_ENSEMBLE_LANES; v++) {
+        e->time[v] += e->T;
+
+        if (e->time[v] > e->wlen[v]) {
+            e->time[v] -= e->wlen[v];
+            setup_waveform(e, v);
+        }
+
+        if (e->phase[v] == 0 && e->time[v] > e->Tw[v]) {
+            SKFLT t;
+            t = e->time[v] / e->wlen[v];
+            e->phase[v] = 1;
+            e->ret[v] = exp(-e->epsilon[v] * (t - e->Tw[v]/e->wlen[v]));
+        }
+    }
+}
+#line 450 "ensemble.org"
+static void glottis_compute(sk_ensemble *e, int k, SKFLT *g)
+{
+    int l;
+
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        SKFLT open, ret, zr, noise;
+        int v;
+
+        v = k + l;
+
+        open = e->zi[v];
+        ret = (-e->ret[v] + e->shift[v]) / e->delta[v];
+
+        e->rng[v] = (1103515245U * e->rng[v] + 12345U) & 0x7fffffff;
+        noise = 2.0f * ((SKFLT)(int32_t)e->rng[v] / 2147483648.0f) - 1;
+
+        g[l] = open + e->phase[v] * (ret - open) + e->asp[v] * noise;
+
+        zr = e->zr[v];
+        e->zr[v] = zr*e->dr[v] - e->zi[v]*e->di[v];
+        e->zi[v] = zr*e->di[v] + e->zi[v]*e->dr[v];
+        e->ret[v] *= e->rstep[v];
+    }
+
+    glottis_time(e, k);
+}
+#line 577 "ensemble.org"
+static void shape(sk_ensemble *e, int v)
+{
+    SKFLT A[SK_ENSEMBLE_TRACT];
+    SKFLT sum, noseA;
+    int i;
+    int s;
+    struct sk_ensemble_group *gp;
+    int l;
+
+    gp = &e->grp[v / SK_ENSEMBLE_LANES];
+    l = v % SK_ENSEMBLE_LANES;
+
+    if (e->tongue_pos[v] >= 0) {
+#line 618 "ensemble.org"
+{
+    SKFLT pos, diam, t, fixed, curve;
+    int blade_start, lip_start, tip_start;
+
+    blade_start = 10;
+    lip_start = 39;
+    tip_start = 32;
+    pos = 12 + 16.0 * e->tongue_pos[v];
+    diam = 3.5 * e->tongue_diam[v];
+
+    for (i = blade_start; i < lip_start; i++) {
+        t = 1.1 * M_PI *
+            (SKFLT)(pos - i)/(tip_start - blade_start);
+        fixed = 2+(diam-2)/1.5;
+        curve = (1.5 - fixed) * cos(t);
+        if (i == blade_start - 2 || i == lip_start - 1) curve *= 0.8;
+        if (i == blade_start || i == lip_start - 2) curve *= 0.94;
+        gp->diameter[i][l] = 1.5 - curve;
+    }
+}
+#line 591 "ensemble.org"
+    }
+
+    for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+        A[i] = gp->diameter[i][l] * gp->diameter[i][l];
+    }
+
+    for (i = 1; i < SK_ENSEMBLE_TRACT; i++) {
+        if (A[i] == 0) {
+            gp->reflection[i][l] = 0.999;
+        } else {
+            gp->reflection[i][l] = (A[i - 1] - A[i]) / (A[i - 1] + A[i]);
+        }
+    }
+
+    s = SK_ENSEMBLE_NOSE_START;
+    noseA = e->velum[v] * e->velum[v];
+    sum = A[s] + A[s + 1] + noseA;
+    gp->rleft[l] = (SKFLT)(2 * A[s] - sum) / sum;
+    gp->rright[l] = (SKFLT)(2 * A[s + 1] - sum) / sum;
+    gp->rnose[l] = (SKFLT)(2 * noseA - sum) / sum;
+}
+#line 667 "ensemble.org"
+static void tract_compute(struct sk_ensemble_group *gp,
+                          const SKFLT *nose_reflection,
+                          const SKFLT *in,
+                          SKFLT *out)
+{
+    SKFLT rp[SK_ENSEMBLE_LANES];
+    SKFLT rlast[SK_ENSEMBLE_LANES];
+    SKFLT nl0[SK_ENSEMBLE_LANES];
+    SKFLT nlast[SK_ENSEMBLE_LANES];
+    SKFLT nj0[SK_ENSEMBLE_LANES];
+    int i, l;
+    int last, nlst;
+    int s;
+
+    last = SK_ENSEMBLE_TRACT - 1;
+    nlst = SK_ENSEMBLE_NOSE - 1;
+    s = SK_ENSEMBLE_NOSE_START;
+
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        rlast[l] = gp->R[last][l];
+        nl0[l] = gp->noseL[0][l];
+        nlast[l] = gp->noseR[nlst][l];
+        rp[l] = gp->R[0][l];
+        gp->R[0][l] = (gp->L[0][l] * 0.75f + in[l]) * 0.999f;
+    }
+
+    for (i = 1; i < s; i++) {
+#line 717 "ensemble.org"
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    SKFLT w, lo, ro;
+    lo = gp->L[i][l];
+    ro = gp->R[i][l];
+    w = gp->reflection[i][l] * (rp[l] + lo);
+    gp->R[i][l] = (rp[l] - w) * 0.999f;
+    gp->L[i - 1][l] = (lo + w) * 0.999f;
+    rp[l] = ro;
+}
+#line 695 "ensemble.org"
+    }
+
+#line 734 "ensemble.org"
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    SKFLT r, lo, ro;
+
+    lo = gp->L[s][l];
+    ro = gp->R[s][l];
+
+    r = gp->rleft[l];
+    gp->L[s - 1][l] = (r*rp[l] + (1 + r)*(nl0[l] + lo)) * 0.999f;
+
+    r = gp->rright[l];
+    gp->R[s][l] = (r*lo + (1 + r)*(rp[l] + nl0[l])) * 0.999f;
+
+    r = gp->rnose[l];
+    nj0[l] = r*nl0[l] + (1 + r)*(lo + rp[l]);
+
+    rp[l] = ro;
+}
+#line 698 "ensemble.org"
+
+    for (i = s + 1; i < SK_ENSEMBLE_TRACT; i++) {
+#line 717 "ensemble.org"
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    SKFLT w, lo, ro;
+    lo = gp->L[i][l];
+    ro = gp->R[i][l];
+    w = gp->reflection[i][l] * (rp[l] + lo);
+    gp->R[i][l] = (rp[l] - w) * 0.999f;
+    gp->L[i - 1][l] = (lo + w) * 0.999f;
+    rp[l] = ro;
+}
+#line 701 "ensemble.org"
+    }
+
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        gp->L[last][l] = rlast[l] * -0.85f * 0.999f;
+    }
+
+#line 757 "ensemble.org"
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    rp[l] = gp->noseR[0][l];
+    gp->noseR[0][l] = nj0[l];
+}
+
+for (i = 1; i < SK_ENSEMBLE_NOSE; i++) {
+    SKFLT r;
+    r = nose_reflection[i];
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        SKFLT w, lo, ro;
+        lo = gp->noseL[i][l];
+        ro = gp->noseR[i][l];
+        w = r * (rp[l] + lo);
+        gp->noseR[i][l] = rp[l] - w;
+        gp->noseL[i - 1][l] = lo + w;
+        rp[l] = ro;
+    }
+}
+
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    gp->noseL[nlst][l] = nlast[l] * -0.85f;
+}
+#line 708 "ensemble.org"
+
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        out[l] += gp->R[last][l] + gp->noseR[nlst][l];
+    }
+}
+#line 792 "ensemble.org"
+void sk_ensemble_compute(sk_ensemble *e, int n, SKFLT *out)
+{
+    int j, k;
+
+    if (n <= 0) return;
+
+    for (j = 0; j < n; j++) out[j] = 0;
+
+    for (k = 0; k < e->nvoices; k += SK_ENSEMBLE_LANES) {
+        compute_group(e, k, n, out);
+    }
+}
+#line 824 "ensemble.org"
+static void compute_group(sk_ensemble *e, int k, int n, SKFLT *out)
+{
+    SKFLT target[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+    SKFLT step[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+    SKFLT ntarget[3][SK_ENSEMBLE_LANES];
+    SKFLT nstep[3][SK_ENSEMBLE_LANES];
+    SKFLT g[SK_ENSEMBLE_LANES];
+    SKFLT y[SK_ENSEMBLE_LANES];
+    SKFLT amp[SK_ENSEMBLE_LANES];
+    struct sk_ensemble_group *gp;
+    int ramp;
+    int i, j, l;
+
+    gp = &e->grp[k / SK_ENSEMBLE_LANES];
+    ramp = 0;
+
+    for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+        e->asp[k + l] = (1 - sqrt(e->tenseness[k + l])) * 0.3 * 0.2;
+        amp[l] = e->amp[k + l] * 0.125f;
+    }
+
+#line 871 "ensemble.org"
+for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+    SKFLT prev[SK_ENSEMBLE_TRACT + 3];
+    int v;
+
+    v = k + l;
+
+    if (e->tongue_pos[v] == e->ppos[v] &&
+        e->tongue_diam[v] == e->pdiam[v] &&
+        e->velum[v] == e->pvelum[v]) {
+        for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+            target[i][l] = gp->reflection[i][l];
+            step[i][l] = 0;
+        }
+        ntarget[0][l] = gp->rleft[l];
+        ntarget[1][l] = gp->rright[l];
+        ntarget[2][l] = gp->rnose[l];
+        nstep[0][l] = nstep[1][l] = nstep[2][l] = 0;
+        continue;
+    }
+
+    /* the first shape is used as is */
+    if (e->ppos[v] == -1 && e->pdiam[v] == -1 && e->pvelum[v] == -1) {
+        shape(e, v);
+    }
+
+    for (i = 0; i < SK_ENSEMBLE_TRACT; i++) prev[i] = gp->reflection[i][l];
+    prev[i] = gp->rleft[l];
+    prev[i + 1] = gp->rright[l];
+    prev[i + 2] = gp->rnose[l];
+
+    shape(e, v);
+    e->ppos[v] = e->tongue_pos[v];
+    e->pdiam[v] = e->tongue_diam[v];
+    e->pvelum[v] = e->velum[v];
+    ramp = 1;
+
+    for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+        target[i][l] = gp->reflection[i][l];
+        step[i][l] = (target[i][l] - prev[i]) / n;
+        gp->reflection[i][l] = prev[i];
+    }
+
+    ntarget[0][l] = gp->rleft[l];
+    ntarget[1][l] = gp->rright[l];
+    ntarget[2][l] = gp->rnose[l];
+    nstep[0][l] = (ntarget[0][l] - prev[i]) / n;
+    nstep[1][l] = (ntarget[1][l] - prev[i + 1]) / n;
+    nstep[2][l] = (ntarget[2][l] - prev[i + 2]) / n;
+    gp->rleft[l] = prev[i];
+    gp->rright[l] = prev[i + 1];
+    gp->rnose[l] = prev[i + 2];
+}
+#line 846 "ensemble.org"
+
+    for (j = 0; j < n; j++) {
+        SKFLT mix;
+
+#line 930 "ensemble.org"
+if (ramp) {
+    if (j == n - 1) {
+        for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+            for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+                gp->reflection[i][l] = target[i][l];
+            }
+        }
+        for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+            gp->rleft[l] = ntarget[0][l];
+            gp->rright[l] = ntarget[1][l];
+            gp->rnose[l] = ntarget[2][l];
+        }
+    } else {
+        for (i = 0; i < SK_ENSEMBLE_TRACT; i++) {
+            for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+                gp->reflection[i][l] += step[i][l];
+            }
+        }
+        for (l = 0; l < SK_ENSEMBLE_LANES; l++) {
+            gp->rleft[l] += nstep[0][l];
+            gp->rright[l] += nstep[1][l];
+            gp->rnose[l] += nstep[2][l];
+        }
+    }
+}
+#line 851 "ensemble.org"
+
+        glottis_compute(e, k, g);
+
+        for (l = 0; l < SK_ENSEMBLE_LANES; l++) y[l] = 0;
+        tract_compute(gp, e->nose_reflection, g, y);
+        tract_compute(gp, e->nose_reflection, g, y);
+
+        mix = 0;
+        for (l = 0; l < SK_ENSEMBLE_LANES; l++) mix += y[l] * amp[l];
+        out[j] += mix;
+    }
+}
+#line 59 "ensemble.org"
@@ -0,0 +1,91 @@
+#line 38 "ensemble.org"
+#ifndef SK_ENSEMBLE_H
+#define SK_ENSEMBLE_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#define SK_ENSEMBLE_MAX 16
+
+#line 75 "ensemble.org"
+typedef struct sk_ensemble sk_ensemble;
+#line 48 "ensemble.org"
+
+#ifdef SK_ENSEMBLE_PRIV
+#line 83 "ensemble.org"
+#define SK_ENSEMBLE_TRACT 44
+#define SK_ENSEMBLE_NOSE 28
+#define SK_ENSEMBLE_NOSE_START 17
+
+#ifndef SK_ENSEMBLE_LANES
+#define SK_ENSEMBLE_LANES 4
+#endif
+
+struct sk_ensemble_group {
+#line 502 "ensemble.org"
+SKFLT diameter[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+SKFLT reflection[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+SKFLT R[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+SKFLT L[SK_ENSEMBLE_TRACT][SK_ENSEMBLE_LANES];
+SKFLT rleft[SK_ENSEMBLE_LANES];
+SKFLT rright[SK_ENSEMBLE_LANES];
+SKFLT rnose[SK_ENSEMBLE_LANES];
+SKFLT noseR[SK_ENSEMBLE_NOSE][SK_ENSEMBLE_LANES];
+SKFLT noseL[SK_ENSEMBLE_NOSE][SK_ENSEMBLE_LANES];
+#line 93 "ensemble.org"
+};
+
+struct sk_ensemble {
+    int nvoices;
+    SKFLT T;
+#line 223 "ensemble.org"
+SKFLT freq[SK_ENSEMBLE_MAX];
+SKFLT tenseness[SK_ENSEMBLE_MAX];
+SKFLT time[SK_ENSEMBLE_MAX];
+SKFLT wlen[SK_ENSEMBLE_MAX];
+SKFLT Tw[SK_ENSEMBLE_MAX];
+#line 259 "ensemble.org"
+SKFLT zr[SK_ENSEMBLE_MAX], zi[SK_ENSEMBLE_MAX];
+SKFLT dr[SK_ENSEMBLE_MAX], di[SK_ENSEMBLE_MAX];
+SKFLT ret[SK_ENSEMBLE_MAX];
+SKFLT rstep[SK_ENSEMBLE_MAX];
+SKFLT shift[SK_ENSEMBLE_MAX];
+SKFLT delta[SK_ENSEMBLE_MAX];
+SKFLT epsilon[SK_ENSEMBLE_MAX];
+SKFLT phase[SK_ENSEMBLE_MAX];
+#line 277 "ensemble.org"
+uint32_t rng[SK_ENSEMBLE_MAX];
+SKFLT asp[SK_ENSEMBLE_MAX];
+#line 93 "ensemble.org"
+#line 485 "ensemble.org"
+SKFLT tongue_pos[SK_ENSEMBLE_MAX];
+SKFLT tongue_diam[SK_ENSEMBLE_MAX];
+SKFLT velum[SK_ENSEMBLE_MAX];
+SKFLT ppos[SK_ENSEMBLE_MAX];
+SKFLT pdiam[SK_ENSEMBLE_MAX];
+SKFLT pvelum[SK_ENSEMBLE_MAX];
+SKFLT amp[SK_ENSEMBLE_MAX];
+SKFLT nose_reflection[SK_ENSEMBLE_NOSE];
+#line 100 "ensemble.org"
+    struct sk_ensemble_group grp[SK_ENSEMBLE_MAX / SK_ENSEMBLE_LANES];
+};
+#line 51 "ensemble.org"
+#endif
+
+#line 122 "ensemble.org"
+void sk_ensemble_init(sk_ensemble *e, int sr, int nvoices);
+#line 165 "ensemble.org"
+void sk_ensemble_freq(sk_ensemble *e, int v, SKFLT freq);
+void sk_ensemble_tenseness(sk_ensemble *e, int v, SKFLT tenseness);
+void sk_ensemble_tongue(sk_ensemble *e, int v,
+                        SKFLT position, SKFLT diameter);
+void sk_ensemble_velum(sk_ensemble *e, int v, SKFLT velum);
+void sk_ensemble_amp(sk_ensemble *e, int v, SKFLT amp);
+int sk_ensemble_nvoices(sk_ensemble *e);
+#line 283 "ensemble.org"
+void sk_ensemble_seed(sk_ensemble *e, int v, unsigned long seed);
+#line 787 "ensemble.org"
+void sk_ensemble_compute(sk_ensemble *e, int n, SKFLT *out);
+#line 54 "ensemble.org"
+#endif
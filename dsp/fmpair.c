@@ -0,0 +1,430 @@
+#line 130 "fmpair.org"
+#include <math.h>
+#include <stddef.h>
+#define SK_FMPAIR_PRIV
+#include "fmpair.h"
+#line 179 "fmpair.org"
+#define SK_FMPAIR_MAXLEN 0x1000000L
+#define SK_FMPAIR_PHASEMASK 0x0FFFFFFL
+#line 130 "fmpair.org"
+#line 304 "fmpair.org"
+void sk_fmpair_init(sk_fmpair *fmp, int sr,
+                    SKFLT *ctab, int csz, SKFLT ciphs,
+                    SKFLT *mtab, int msz, SKFLT miphs)
+{
+#line 199 "fmpair.org"
+fmp->ctab = ctab;
+fmp->csz = csz;
+#line 215 "fmpair.org"
+fmp->mtab = mtab;
+fmp->msz = msz;
+#line 227 "fmpair.org"
+fmp->clphs = floor(ciphs * SK_FMPAIR_MAXLEN);
+fmp->mlphs = floor(miphs * SK_FMPAIR_MAXLEN);
+#line 254 "fmpair.org"
+{
+    int tmp;
+
+    /* carrier */
+    tmp = SK_FMPAIR_MAXLEN / csz;
+    fmp->cnlb = 0;
+    while (tmp >>= 1) fmp->cnlb++;
+
+    /* modulator */
+    tmp = SK_FMPAIR_MAXLEN / msz;
+    fmp->mnlb = 0;
+    while (tmp >>= 1) fmp->mnlb++;
+}
+
+/* phase mask for dividing lower/upper bits */
+
+fmp->cmask = (1<<fmp->cnlb) - 1;
+fmp->mmask = (1<<fmp->mnlb) - 1;
+
+/* constant used to convert to floating point */
+
+fmp->cinlb = 1.0 / (1<<fmp->cnlb);
+fmp->minlb = 1.0 / (1<<fmp->mnlb);
+
+/* max table length in seconds */
+/* used to convert cycles-per-second units to cycles */
+
+fmp->maxlens = 1.0 * SK_FMPAIR_MAXLEN / sr;
+#line 337 "fmpair.org"
+sk_fmpair_freq(fmp, 440);
+#line 371 "fmpair.org"
+sk_fmpair_carrier(fmp, 1);
+sk_fmpair_modulator(fmp, 1);
+#line 400 "fmpair.org"
+sk_fmpair_modindex(fmp, 1);
+#line 309 "fmpair.org"
+}
+#line 322 "fmpair.org"
+void sk_fmpair_freq(sk_fmpair *fmp, SKFLT freq)
+{
+    fmp->freq = freq;
+}
+#line 350 "fmpair.org"
+void sk_fmpair_modulator(sk_fmpair *fmp, SKFLT mod)
+{
+    fmp->mod = mod;
+}
+
+void sk_fmpair_carrier(sk_fmpair *fmp, SKFLT car)
+{
+    fmp->car = car;
+}
+#line 384 "fmpair.org"
+void sk_fmpair_modindex(sk_fmpair *fmp, SKFLT index)
+{
+    fmp->index = index;
+}
+#line 412 "fmpair.org"
+SKFLT sk_fmpair_tick(sk_fmpair *fmp)
+{
+    SKFLT out;
+    SKFLT cfreq, mfreq;
+    SKFLT modout;
+    int ipos;
+    SKFLT frac;
+    SKFLT x[2];
+    out = 0;
+#line 437 "fmpair.org"
+cfreq = fmp->freq * fmp->car;
+mfreq = fmp->freq * fmp->mod;
+#line 412 "fmpair.org"
+#line 447 "fmpair.org"
+fmp->mlphs &= SK_FMPAIR_PHASEMASK;
+ipos = fmp->mlphs >> fmp->mnlb;
+x[0] = fmp->mtab[ipos];
+
+if (ipos == fmp->msz - 1) {
+    x[1] = fmp->mtab[0];
+} else {
+    x[1] = fmp->mtab[ipos + 1];
+}
+
+frac = (fmp->mlphs & fmp->mmask) * fmp->minlb;
+modout = (x[0] + (x[1] - x[0]) * frac);
+#line 412 "fmpair.org"
+#line 468 "fmpair.org"
+modout *= mfreq * fmp->index;
+#line 412 "fmpair.org"
+#line 477 "fmpair.org"
+cfreq += modout;
+#line 412 "fmpair.org"
+#line 486 "fmpair.org"
+fmp->clphs &= SK_FMPAIR_PHASEMASK;
+ipos = (fmp->clphs) >> fmp->cnlb;
+x[0] = fmp->ctab[ipos];
+
+if (ipos == fmp->csz - 1) {
+    x[1] = fmp->ctab[0];
+} else {
+    x[1] = fmp->ctab[ipos + 1];
+}
+
+frac = (fmp->clphs & fmp->cmask) * fmp->cinlb;
+out = (x[0] + (x[1] - x[0]) * frac);
+#line 412 "fmpair.org"
+#line 513 "fmpair.org"
+fmp->clphs += floor(cfreq * fmp->maxlens);
+fmp->mlphs += floor(mfreq * fmp->maxlens);
+#line 427 "fmpair.org"
+    return out;
+}
+#line 557 "fmpair.org"
+void sk_fmpair_fdbk_init(sk_fmpair_fdbk *fmp, int sr,
+                         SKFLT *ctab, int csz, SKFLT ciphs,
+                         SKFLT *mtab, int msz, SKFLT miphs)
+{
+    sk_fmpair_init(&fmp->fmpair, sr,
+                   ctab, csz, ciphs,
+                   mtab, msz, miphs);
+    fmp->prev = 0;
+    fmp->feedback = 0;
+}
+#line 578 "fmpair.org"
+void sk_fmpair_fdbk_amt(sk_fmpair_fdbk *f, SKFLT amt)
+{
+    f->feedback = amt;
+}
+#line 601 "fmpair.org"
+SKFLT sk_fmpair_fdbk_tick(sk_fmpair_fdbk *f)
+{
+    SKFLT out;
+    SKFLT cfreq, mfreq;
+    SKFLT modout;
+    int ipos;
+    SKFLT frac;
+    SKFLT x[2];
+    sk_fmpair *fmp;
+    out = 0;
+    fmp = &f->fmpair;
+
+#line 437 "fmpair.org"
+cfreq = fmp->freq * fmp->car;
+mfreq = fmp->freq * fmp->mod;
+#line 601 "fmpair.org"
+#line 447 "fmpair.org"
+fmp->mlphs &= SK_FMPAIR_PHASEMASK;
+ipos = fmp->mlphs >> fmp->mnlb;
+x[0] = fmp->mtab[ipos];
+
+if (ipos == fmp->msz - 1) {
+    x[1] = fmp->mtab[0];
+} else {
+    x[1] = fmp->mtab[ipos + 1];
+}
+
+frac = (fmp->mlphs & fmp->mmask) * fmp->minlb;
+modout = (x[0] + (x[1] - x[0]) * frac);
+#line 615 "fmpair.org"
+
+    /* feedback-oscillator specific */
+#line 635 "fmpair.org"
+modout += f->prev * f->feedback;
+f->prev = modout;
+#line 618 "fmpair.org"
+
+#line 468 "fmpair.org"
+modout *= mfreq * fmp->index;
+#line 620 "fmpair.org"
+
+#line 477 "fmpair.org"
+cfreq += modout;
+#line 620 "fmpair.org"
+#line 486 "fmpair.org"
+fmp->clphs &= SK_FMPAIR_PHASEMASK;
+ipos = (fmp->clphs) >> fmp->cnlb;
+x[0] = fmp->ctab[ipos];
+
+if (ipos == fmp->csz - 1) {
+    x[1] = fmp->ctab[0];
+} else {
+    x[1] = fmp->ctab[ipos + 1];
+}
+
+frac = (fmp->clphs & fmp->cmask) * fmp->cinlb;
+out = (x[0] + (x[1] - x[0]) * frac);
+#line 620 "fmpair.org"
+#line 513 "fmpair.org"
+fmp->clphs += floor(cfreq * fmp->maxlens);
+fmp->mlphs += floor(mfreq * fmp->maxlens);
+#line 624 "fmpair.org"
+    return out;
+}
+#line 674 "fmpair.org"
+void sk_fmpair_compute(sk_fmpair *fmp,
+                       int n,
+                       const SKFLT *freq,
+                       const SKFLT *car,
+                       const SKFLT *mod,
+                       const SKFLT *index,
+                       SKFLT *out)
+{
+    int i;
+    int fs, cs, ms, is;
+
+    if (freq == NULL && car == NULL && mod == NULL && index == NULL) {
+#line 754 "fmpair.org"
+{
+    sk_fmpair *pair;
+#line 801 "fmpair.org"
+SKFLT cbase, mfreq, mscale;
+double minc;
+int clphs, mlphs;
+SKFLT *ctab, *mtab;
+int csz, msz;
+int cnlb, mnlb;
+unsigned long cmask, mmask;
+SKFLT cinlb, minlb;
+SKFLT maxlens;
+#line 757 "fmpair.org"
+
+    pair = fmp;
+#line 814 "fmpair.org"
+cbase = pair->freq * pair->car;
+mfreq = pair->freq * pair->mod;
+mscale = mfreq * pair->index;
+minc = floor(mfreq * pair->maxlens);
+
+clphs = pair->clphs;
+mlphs = pair->mlphs;
+ctab = pair->ctab;
+mtab = pair->mtab;
+csz = pair->csz;
+msz = pair->msz;
+cnlb = pair->cnlb;
+mnlb = pair->mnlb;
+cmask = pair->cmask;
+mmask = pair->mmask;
+cinlb = pair->cinlb;
+minlb = pair->minlb;
+maxlens = pair->maxlens;
+#line 760 "fmpair.org"
+
+    for (i = 0; i < n; i++) {
+#line 836 "fmpair.org"
+SKFLT modout, cfreq, frac;
+SKFLT x[2];
+int ipos;
+
+mlphs &= SK_FMPAIR_PHASEMASK;
+ipos = mlphs >> mnlb;
+x[0] = mtab[ipos];
+x[1] = ipos == msz - 1 ? mtab[0] : mtab[ipos + 1];
+frac = (mlphs & mmask) * minlb;
+modout = (x[0] + (x[1] - x[0]) * frac);
+#line 760 "fmpair.org"
+#line 850 "fmpair.org"
+modout *= mscale;
+cfreq = cbase + modout;
+
+clphs &= SK_FMPAIR_PHASEMASK;
+ipos = clphs >> cnlb;
+x[0] = ctab[ipos];
+x[1] = ipos == csz - 1 ? ctab[0] : ctab[ipos + 1];
+frac = (clphs & cmask) * cinlb;
+out[i] = (x[0] + (x[1] - x[0]) * frac);
+
+clphs += floor(cfreq * maxlens);
+mlphs += minc;
+#line 764 "fmpair.org"
+    }
+
+    pair->clphs = clphs;
+    pair->mlphs = mlphs;
+}
+#line 687 "fmpair.org"
+        return;
+    }
+
+    fs = cs = ms = is = 1;
+    if (freq == NULL) {freq = &fmp->freq; fs = 0;}
+    if (car == NULL) {car = &fmp->car; cs = 0;}
+    if (mod == NULL) {mod = &fmp->mod; ms = 0;}
+    if (index == NULL) {index = &fmp->index; is = 0;}
+
+    for (i = 0; i < n; i++) {
+        fmp->freq = freq[i * fs];
+        fmp->car = car[i * cs];
+        fmp->mod = mod[i * ms];
+        fmp->index = index[i * is];
+        out[i] = sk_fmpair_tick(fmp);
+    }
+}
+
+void sk_fmpair_fdbk_compute(sk_fmpair_fdbk *fmp,
+                            int n,
+                            const SKFLT *freq,
+                            const SKFLT *car,
+                            const SKFLT *mod,
+                            const SKFLT *index,
+                            const SKFLT *fdbk,
+                            SKFLT *out)
+{
+    int i;
+    sk_fmpair *f;
+    int fs, cs, ms, is, ds;
+
+    f = &fmp->fmpair;
+
+    if (freq == NULL && car == NULL && mod == NULL &&
+        index == NULL && fdbk == NULL) {
+#line 776 "fmpair.org"
+{
+    sk_fmpair *pair;
+    SKFLT prev, feedback;
+#line 801 "fmpair.org"
+SKFLT cbase, mfreq, mscale;
+double minc;
+int clphs, mlphs;
+SKFLT *ctab, *mtab;
+int csz, msz;
+int cnlb, mnlb;
+unsigned long cmask, mmask;
+SKFLT cinlb, minlb;
+SKFLT maxlens;
+#line 780 "fmpair.org"
+
+    pair = f;
+    prev = fmp->prev;
+    feedback = fmp->feedback;
+#line 814 "fmpair.org"
+cbase = pair->freq * pair->car;
+mfreq = pair->freq * pair->mod;
+mscale = mfreq * pair->index;
+minc = floor(mfreq * pair->maxlens);
+
+clphs = pair->clphs;
+mlphs = pair->mlphs;
+ctab = pair->ctab;
+mtab = pair->mtab;
+csz = pair->csz;
+msz = pair->msz;
+cnlb = pair->cnlb;
+mnlb = pair->mnlb;
+cmask = pair->cmask;
+mmask = pair->mmask;
+cinlb = pair->cinlb;
+minlb = pair->minlb;
+maxlens = pair->maxlens;
+#line 785 "fmpair.org"
+
+    for (i = 0; i < n; i++) {
+#line 836 "fmpair.org"
+SKFLT modout, cfreq, frac;
+SKFLT x[2];
+int ipos;
+
+mlphs &= SK_FMPAIR_PHASEMASK;
+ipos = mlphs >> mnlb;
+x[0] = mtab[ipos];
+x[1] = ipos == msz - 1 ? mtab[0] : mtab[ipos + 1];
+frac = (mlphs & mmask) * minlb;
+modout = (x[0] + (x[1] - x[0]) * frac);
+#line 788 "fmpair.org"
+        modout += prev * feedback;
+        prev = modout;
+#line 850 "fmpair.org"
+modout *= mscale;
+cfreq = cbase + modout;
+
+clphs &= SK_FMPAIR_PHASEMASK;
+ipos = clphs >> cnlb;
+x[0] = ctab[ipos];
+x[1] = ipos == csz - 1 ? ctab[0] : ctab[ipos + 1];
+frac = (clphs & cmask) * cinlb;
+out[i] = (x[0] + (x[1] - x[0]) * frac);
+
+clphs += floor(cfreq * maxlens);
+mlphs += minc;
+#line 791 "fmpair.org"
+    }
+
+    pair->clphs = clphs;
+    pair->mlphs = mlphs;
+    fmp->prev = prev;
+}
+#line 723 "fmpair.org"
+        return;
+    }
+
+    fs = cs = ms = is = ds = 1;
+    if (freq == NULL) {freq = &f->freq; fs = 0;}
+    if (car == NULL) {car = &f->car; cs = 0;}
+    if (mod == NULL) {mod = &f->mod; ms = 0;}
+    if (index == NULL) {index = &f->index; is = 0;}
+    if (fdbk == NULL) {fdbk = &fmp->feedback; ds = 0;}
+
+    for (i = 0; i < n; i++) {
+        f->freq = freq[i * fs];
+        f->car = car[i * cs];
+        f->mod = mod[i * ms];
+        f->index = index[i * is];
+        fmp->feedback = fdbk[i * ds];
+        out[i] = sk_fmpair_fdbk_tick(fmp);
+    }
+}
+#line 130 "fmpair.org"
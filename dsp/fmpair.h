@@ -0,0 +1,90 @@
+#line 144 "fmpair.org"
+#ifndef SK_FMPAIR_H
+#define SK_FMPAIR_H
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 161 "fmpair.org"
+typedef struct sk_fmpair sk_fmpair;
+#line 528 "fmpair.org"
+typedef struct sk_fmpair_fdbk sk_fmpair_fdbk;
+#line 144 "fmpair.org"
+#line 297 "fmpair.org"
+void sk_fmpair_init(sk_fmpair *fmp, int sr,
+                    SKFLT *ctab, int csz, SKFLT ciphs,
+                    SKFLT *mtab, int msz, SKFLT miphs);
+#line 317 "fmpair.org"
+void sk_fmpair_freq(sk_fmpair *fmp, SKFLT freq);
+#line 344 "fmpair.org"
+void sk_fmpair_modulator(sk_fmpair *fmp, SKFLT mod);
+void sk_fmpair_carrier(sk_fmpair *fmp, SKFLT car);
+#line 379 "fmpair.org"
+void sk_fmpair_modindex(sk_fmpair *fmp, SKFLT index);
+#line 407 "fmpair.org"
+SKFLT sk_fmpair_tick(sk_fmpair *fmp);
+#line 550 "fmpair.org"
+void sk_fmpair_fdbk_init(sk_fmpair_fdbk *fmp, int sr,
+                         SKFLT *ctab, int csz, SKFLT ciphs,
+                         SKFLT *mtab, int msz, SKFLT miphs);
+#line 573 "fmpair.org"
+void sk_fmpair_fdbk_amt(sk_fmpair_fdbk *f, SKFLT amt);
+#line 589 "fmpair.org"
+SKFLT sk_fmpair_fdbk_tick(sk_fmpair_fdbk *fmp);
+#line 645 "fmpair.org"
+void sk_fmpair_compute(sk_fmpair *fmp,
+                       int n,
+                       const SKFLT *freq,
+                       const SKFLT *car,
+                       const SKFLT *mod,
+                       const SKFLT *index,
+                       SKFLT *out);
+void sk_fmpair_fdbk_compute(sk_fmpair_fdbk *fmp,
+                            int n,
+                            const SKFLT *freq,
+                            const SKFLT *car,
+                            const SKFLT *mod,
+                            const SKFLT *index,
+                            const SKFLT *fdbk,
+                            SKFLT *out);
+#line 151 "fmpair.org"
+#ifdef SK_FMPAIR_PRIV
+#line 166 "fmpair.org"
+struct sk_fmpair {
+#line 192 "fmpair.org"
+SKFLT *ctab;
+int csz;
+int clphs;
+#line 208 "fmpair.org"
+SKFLT *mtab;
+int msz;
+int mlphs;
+#line 239 "fmpair.org"
+/* carrier constants */
+int cnlb;
+SKFLT cinlb;
+unsigned long cmask;
+
+/* modulator constants */
+int mnlb;
+SKFLT minlb;
+unsigned long mmask;
+
+SKFLT maxlens;
+#line 330 "fmpair.org"
+SKFLT freq;
+#line 363 "fmpair.org"
+SKFLT car;
+SKFLT mod;
+#line 392 "fmpair.org"
+SKFLT index;
+#line 168 "fmpair.org"
+};
+#line 538 "fmpair.org"
+struct sk_fmpair_fdbk {
+    sk_fmpair fmpair;
+    SKFLT prev;
+    SKFLT feedback;
+};
+#line 153 "fmpair.org"
+#endif
+#endif
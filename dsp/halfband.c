@@ -0,0 +1,141 @@
+#line 36 "halfband.org"
+#include <math.h>
+#include <string.h>
+#define SK_HALFBAND_PRIV
+#include "halfband.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#line 117 "halfband.org"
+static double bessel_i0(double x)
+{
+    double sum, term;
+    int k;
+
+    sum = term = 1.0;
+
+    for (k = 1; k < 50; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < 1e-12 * sum) break;
+    }
+
+    return sum;
+}
+
+void sk_halfband_init(sk_halfband *hb, int m)
+{
+    int ntaps;
+    int j;
+    int i, k;
+    double r, w;
+    double beta;
+
+    if (m < 1) m = 1;
+    if (m > SK_HALFBAND_MAXM) m = SK_HALFBAND_MAXM;
+
+    hb->m = m;
+    ntaps = 4 * m - 1;
+    beta = 8.0;
+
+    for (j = 0; j < 2 * m; j++) {
+        i = 2 * j;
+        k = i - (2 * m - 1);
+        r = 2.0 * i / (ntaps - 1) - 1.0;
+        w = bessel_i0(beta * sqrt(1.0 - r * r)) / bessel_i0(beta);
+        hb->c[j] = sin(M_PI * k / 2) / (M_PI * k) * w;
+    }
+
+    memset(hb->x, 0, sizeof(hb->x));
+    memset(hb->e, 0, sizeof(hb->e));
+}
+#line 172 "halfband.org"
+static void odd_taps(sk_halfband *hb, SKFLT *acc, int n)
+{
+    int h;
+    int j;
+    int k;
+    SKFLT c;
+    const SKFLT *x;
+
+    h = 2 * hb->m - 1;
+
+    for (j = 0; j < 2 * hb->m; j++) {
+        c = hb->c[j];
+        x = hb->x + h - j;
+        for (k = 0; k < n; k++) acc[k] += c * x[k];
+    }
+}
+#line 208 "halfband.org"
+void sk_halfband_up(sk_halfband *hb,
+                    const SKFLT *in,
+                    SKFLT *out,
+                    int n)
+{
+    SKFLT acc[SK_HALFBAND_CHUNK];
+    int h, d;
+    int len;
+    int k;
+
+    h = 2 * hb->m - 1;
+    d = h - (hb->m - 1);
+
+    while (n > 0) {
+        len = n < SK_HALFBAND_CHUNK ? n : SK_HALFBAND_CHUNK;
+
+        memcpy(hb->x + h, in, sizeof(SKFLT) * len);
+        for (k = 0; k < len; k++) acc[k] = 0;
+
+        odd_taps(hb, acc, len);
+
+        for (k = 0; k < len; k++) {
+            out[2 * k] = 2 * acc[k];
+            out[2 * k + 1] = hb->x[d + k];
+        }
+
+        memmove(hb->x, hb->x + len, sizeof(SKFLT) * h);
+
+        in += len;
+        out += 2 * len;
+        n -= len;
+    }
+}
+#line 259 "halfband.org"
+void sk_halfband_down(sk_halfband *hb,
+                      const SKFLT *in,
+                      SKFLT *out,
+                      int n)
+{
+    SKFLT acc[SK_HALFBAND_CHUNK];
+    int h, d;
+    int len;
+    int k;
+
+    h = 2 * hb->m - 1;
+    d = hb->m - 1;
+
+    while (n > 0) {
+        len = n < SK_HALFBAND_CHUNK ? n : SK_HALFBAND_CHUNK;
+
+        for (k = 0; k < len; k++) {
+            hb->e[d + k] = in[2 * k];
+            hb->x[h + k] = in[2 * k + 1];
+        }
+
+        for (k = 0; k < len; k++) acc[k] = 0.5 * hb->e[k];
+
+        odd_taps(hb, acc, len);
+
+        for (k = 0; k < len; k++) out[k] = acc[k];
+
+        memmove(hb->x, hb->x + len, sizeof(SKFLT) * h);
+        memmove(hb->e, hb->e + len, sizeof(SKFLT) * d);
+
+        in += 2 * len;
+        out += len;
+        n -= len;
+    }
+}
+#line 36 "halfband.org"
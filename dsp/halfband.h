@@ -0,0 +1,40 @@
+#line 50 "halfband.org"
+#ifndef SK_HALFBAND_H
+#define SK_HALFBAND_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#line 69 "halfband.org"
+typedef struct sk_halfband sk_halfband;
+#line 58 "halfband.org"
+
+#ifdef SK_HALFBAND_PRIV
+#line 88 "halfband.org"
+#define SK_HALFBAND_MAXM 16
+#define SK_HALFBAND_CHUNK 64
+
+struct sk_halfband {
+    int m;
+    SKFLT c[2 * SK_HALFBAND_MAXM];
+    SKFLT x[2 * SK_HALFBAND_MAXM - 1 + SK_HALFBAND_CHUNK];
+    SKFLT e[SK_HALFBAND_MAXM - 1 + SK_HALFBAND_CHUNK];
+};
+#line 61 "halfband.org"
+#endif
+
+#line 104 "halfband.org"
+void sk_halfband_init(sk_halfband *hb, int m);
+#line 200 "halfband.org"
+void sk_halfband_up(sk_halfband *hb,
+                    const SKFLT *in,
+                    SKFLT *out,
+                    int n);
+#line 251 "halfband.org"
+void sk_halfband_down(sk_halfband *hb,
+                      const SKFLT *in,
+                      SKFLT *out,
+                      int n);
+#line 64 "halfband.org"
+#endif
@@ -0,0 +1,184 @@
+#line 41 "modalbank.org"
+#include <math.h>
+#define SK_MODALBANK_PRIV
+#include "modalbank.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#line 116 "modalbank.org"
+static void clear(sk_modalbank *mb, int k);
+#line 316 "modalbank.org"
+static void compute_group(sk_modalbank *mb,
+                          int k,
+                          int n,
+                          const SKFLT *x,
+                          SKFLT acc[][SK_MODALBANK_LANES]);
+#line 41 "modalbank.org"
+#line 97 "modalbank.org"
+void sk_modalbank_init(sk_modalbank *mb, int sr)
+{
+    int k;
+
+    mb->sr = sr;
+    mb->nmodes = 0;
+    mb->x = 0;
+
+    for (k = 0; k < SK_MODALBANK_MAX; k++) clear(mb, k);
+}
+#line 121 "modalbank.org"
+static void clear(sk_modalbank *mb, int k)
+{
+    mb->freq[k] = -1;
+    mb->q[k] = -1;
+    mb->gain[k] = 0;
+    mb->s[k] = 0;
+    mb->b1[k] = 0;
+    mb->a1[k] = 0;
+    mb->a2[k] = 0;
+    mb->g[k] = 0;
+    mb->y0[k] = 0;
+    mb->y1[k] = 0;
+}
+#line 148 "modalbank.org"
+void sk_modalbank_nmodes(sk_modalbank *mb, int nmodes)
+{
+    int k;
+
+    if (nmodes < 0) nmodes = 0;
+    if (nmodes > SK_MODALBANK_MAX) nmodes = SK_MODALBANK_MAX;
+
+    for (k = nmodes; k < mb->nmodes; k++) clear(mb, k);
+
+    mb->nmodes = nmodes;
+}
+
+int sk_modalbank_nmodes_get(sk_modalbank *mb)
+{
+    return mb->nmodes;
+}
+#line 179 "modalbank.org"
+void sk_modalbank_mode(sk_modalbank *mb, int k,
+                       SKFLT freq, SKFLT q, SKFLT gain)
+{
+    if (k < 0 || k >= mb->nmodes) return;
+
+    if (freq != mb->freq[k] || q != mb->q[k]) {
+        SKFLT w;
+        SKFLT a, b, d;
+
+        w = freq * 2.0 * M_PI;
+
+        a = mb->sr / w;
+        b = a*a;
+        d = 0.5*a;
+
+        mb->freq[k] = freq;
+        mb->q[k] = q;
+
+        mb->b1[k] = 1.0 / (b + d/q);
+        mb->a1[k] = (1.0 - 2.0*b) * mb->b1[k];
+        mb->a2[k] = (b - d/q) * mb->b1[k];
+        mb->s[k] = d;
+        mb->gain[k] = gain;
+        mb->g[k] = gain * d;
+    } else if (gain != mb->gain[k]) {
+        mb->gain[k] = gain;
+        mb->g[k] = gain * mb->s[k];
+    }
+}
+#line 221 "modalbank.org"
+SKFLT sk_modalbank_tick(sk_modalbank *mb, SKFLT in)
+{
+    int k;
+    SKFLT y, out;
+
+    out = 0;
+
+    for (k = 0; k < mb->nmodes; k++) {
+        y = mb->b1[k]*mb->x - mb->a1[k]*mb->y0[k] - mb->a2[k]*mb->y1[k];
+        mb->y1[k] = mb->y0[k];
+        mb->y0[k] = y;
+        out += mb->g[k] * y;
+    }
+
+    mb->x = in;
+    return out;
+}
+#line 277 "modalbank.org"
+void sk_modalbank_compute(sk_modalbank *mb,
+                          int n,
+                          const SKFLT *in,
+                          SKFLT *out)
+{
+    SKFLT acc[SK_MODALBANK_CHUNK][SK_MODALBANK_LANES];
+    SKFLT x[SK_MODALBANK_CHUNK];
+    int pos, len;
+    int j, l, k;
+
+    for (pos = 0; pos < n; pos += len) {
+        len = n - pos;
+        if (len > SK_MODALBANK_CHUNK) len = SK_MODALBANK_CHUNK;
+
+        /* each sample uses the input from the one before */
+        x[0] = mb->x;
+        for (j = 1; j < len; j++) x[j] = in[pos + j - 1];
+        mb->x = in[pos + len - 1];
+
+        for (j = 0; j < len; j++) {
+            for (l = 0; l < SK_MODALBANK_LANES; l++) acc[j][l] = 0;
+        }
+
+        for (k = 0; k < mb->nmodes; k += SK_MODALBANK_LANES) {
+            compute_group(mb, k, len, x, acc);
+        }
+
+        for (j = 0; j < len; j++) {
+            SKFLT sum;
+            sum = 0;
+            for (l = 0; l < SK_MODALBANK_LANES; l++) sum += acc[j][l];
+            out[pos + j] = sum;
+        }
+    }
+}
+#line 325 "modalbank.org"
+static void compute_group(sk_modalbank *mb,
+                          int k,
+                          int n,
+                          const SKFLT *x,
+                          SKFLT acc[][SK_MODALBANK_LANES])
+{
+    SKFLT b1[SK_MODALBANK_LANES];
+    SKFLT a1[SK_MODALBANK_LANES];
+    SKFLT a2[SK_MODALBANK_LANES];
+    SKFLT g[SK_MODALBANK_LANES];
+    SKFLT y0[SK_MODALBANK_LANES];
+    SKFLT y1[SK_MODALBANK_LANES];
+    int j, l;
+
+    for (l = 0; l < SK_MODALBANK_LANES; l++) {
+        b1[l] = mb->b1[k + l];
+        a1[l] = mb->a1[k + l];
+        a2[l] = mb->a2[k + l];
+        g[l] = mb->g[k + l];
+        y0[l] = mb->y0[k + l];
+        y1[l] = mb->y1[k + l];
+    }
+
+    for (j = 0; j < n; j++) {
+        for (l = 0; l < SK_MODALBANK_LANES; l++) {
+            SKFLT y;
+            y = b1[l]*x[j] - a1[l]*y0[l] - a2[l]*y1[l];
+            y1[l] = y0[l];
+            y0[l] = y;
+            acc[j][l] += g[l] * y;
+        }
+    }
+
+    for (l = 0; l < SK_MODALBANK_LANES; l++) {
+        mb->y0[k + l] = y0[l];
+        mb->y1[k + l] = y1[l];
+    }
+}
+#line 41 "modalbank.org"
@@ -0,0 +1,54 @@
+#line 20 "modalbank.org"
+#ifndef SK_MODALBANK_H
+#define SK_MODALBANK_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#define SK_MODALBANK_MAX 256
+
+#line 55 "modalbank.org"
+typedef struct sk_modalbank sk_modalbank;
+#line 30 "modalbank.org"
+
+#ifdef SK_MODALBANK_PRIV
+#line 70 "modalbank.org"
+struct sk_modalbank {
+    int sr;
+    int nmodes;
+    SKFLT x;
+    SKFLT freq[SK_MODALBANK_MAX];
+    SKFLT q[SK_MODALBANK_MAX];
+    SKFLT gain[SK_MODALBANK_MAX];
+    SKFLT s[SK_MODALBANK_MAX];
+    SKFLT b1[SK_MODALBANK_MAX];
+    SKFLT a1[SK_MODALBANK_MAX];
+    SKFLT a2[SK_MODALBANK_MAX];
+    SKFLT g[SK_MODALBANK_MAX];
+    SKFLT y0[SK_MODALBANK_MAX];
+    SKFLT y1[SK_MODALBANK_MAX];
+};
+#line 271 "modalbank.org"
+#define SK_MODALBANK_LANES 16
+#define SK_MODALBANK_CHUNK 64
+#line 33 "modalbank.org"
+#endif
+
+#line 92 "modalbank.org"
+void sk_modalbank_init(sk_modalbank *mb, int sr);
+#line 142 "modalbank.org"
+void sk_modalbank_nmodes(sk_modalbank *mb, int nmodes);
+int sk_modalbank_nmodes_get(sk_modalbank *mb);
+#line 173 "modalbank.org"
+void sk_modalbank_mode(sk_modalbank *mb, int k,
+                       SKFLT freq, SKFLT q, SKFLT gain);
+#line 216 "modalbank.org"
+SKFLT sk_modalbank_tick(sk_modalbank *mb, SKFLT in);
+#line 245 "modalbank.org"
+void sk_modalbank_compute(sk_modalbank *mb,
+                          int n,
+                          const SKFLT *in,
+                          SKFLT *out);
+#line 36 "modalbank.org"
+#endif
@@ -0,0 +1,194 @@
+#line 44 "osc.org"
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#define SK_OSC_PRIV
+#include "osc.h"
+#line 105 "osc.org"
+#define SK_OSC_MAXLEN 0x1000000L
+#define SK_OSC_PHASEMASK 0x0FFFFFFL
+#line 44 "osc.org"
+#line 92 "osc.org"
+void sk_osc_freq(sk_osc *osc, SKFLT freq)
+{
+    osc->freq = freq;
+}
+
+void sk_osc_amp(sk_osc *osc, SKFLT amp)
+{
+    osc->amp = amp;
+}
+#line 253 "osc.org"
+void sk_osc_init(sk_osc *osc, int sr, SKFLT *wt, int sz, SKFLT iphs)
+{
+#line 140 "osc.org"
+osc->freq = 440;
+osc->amp = 0.2;
+#line 149 "osc.org"
+osc->tab = wt;
+osc->sz = sz;
+#line 160 "osc.org"
+osc->inc = 0;
+#line 170 "osc.org"
+osc->lphs = ((int32_t)(iphs * SK_OSC_MAXLEN)) & SK_OSC_PHASEMASK;
+#line 204 "osc.org"
+{
+    uint32_t tmp;
+    tmp = SK_OSC_MAXLEN / sz;
+    osc->nlb = 0;
+    while (tmp >>= 1) osc->nlb++;
+}
+#line 227 "osc.org"
+osc->mask = (1<<osc->nlb) - 1;
+#line 204 "osc.org"
+#line 237 "osc.org"
+osc->inlb = 1.0 / (1<<osc->nlb);
+#line 204 "osc.org"
+#line 246 "osc.org"
+osc->maxlens = 1.0 * SK_OSC_MAXLEN / sr;
+#line 204 "osc.org"
+#line 256 "osc.org"
+}
+#line 265 "osc.org"
+SKFLT sk_osc_tick(sk_osc *osc)
+{
+    SKFLT out;
+    SKFLT fract;
+    SKFLT x1, x2;
+    int32_t phs;
+    int pos;
+
+    out = 0;
+#line 330 "osc.org"
+osc->inc = sk_osc_rintf(osc->freq * osc->maxlens);
+#line 265 "osc.org"
+#line 392 "osc.org"
+phs = osc->lphs;
+pos = phs >> osc->nlb;
+x1 = osc->tab[pos];
+x2 = osc->tab[(pos + 1) % osc->sz];
+#line 265 "osc.org"
+#line 419 "osc.org"
+fract = (phs & osc->mask) * osc->inlb;
+#line 265 "osc.org"
+#line 446 "osc.org"
+out = (x1 + (x2 - x1) * fract) * osc->amp;
+#line 265 "osc.org"
+#line 455 "osc.org"
+phs += osc->inc;
+phs &= SK_OSC_PHASEMASK;
+osc->lphs = phs;
+#line 279 "osc.org"
+    return out;
+}
+#line 356 "osc.org"
+/* ported from MUSL library. License: MIT */
+#define MUSL_FLT_EPSILON 1.1920928955078125e-07F
+#define MUSL_EPS MUSL_FLT_EPSILON
+static const float toint = 1/MUSL_EPS;
+float sk_osc_rintf(float x)
+{
+	int e;
+	int s;
+	float y;
+	union {float f; uint32_t i;} u;
+
+    u.f = x;
+
+	e = u.i>>23 & 0xff;
+	s = u.i>>31;
+
+	if (e >= 0x7f+23)
+		return x;
+	if (s)
+		y = x - toint + toint;
+	else
+		y = x + toint - toint;
+	if (y == 0)
+		return s ? -0.0f : 0.0f;
+	return y;
+}
+#line 479 "osc.org"
+void sk_osc_compute(sk_osc *osc,
+                    int n,
+                    const SKFLT *freq,
+                    const SKFLT *amp,
+                    SKFLT *out)
+{
+    int i;
+
+    if (freq == NULL) {
+#line 517 "osc.org"
+{
+    int32_t phs;
+    int inc;
+    uint32_t nlb, mask;
+    SKFLT inlb;
+    SKFLT *tab;
+    size_t sz;
+
+    osc->inc = sk_osc_rintf(osc->freq * osc->maxlens);
+
+    phs = osc->lphs;
+    inc = osc->inc;
+    nlb = osc->nlb;
+    mask = osc->mask;
+    inlb = osc->inlb;
+    tab = osc->tab;
+    sz = osc->sz;
+
+    if (amp == NULL) {
+        SKFLT a;
+
+        a = osc->amp;
+
+        for (i = 0; i < n; i++) {
+            int pos;
+            SKFLT x1, x2, fract;
+
+            pos = phs >> nlb;
+            x1 = tab[pos];
+            x2 = tab[(pos + 1) % sz];
+            fract = (phs & mask) * inlb;
+            out[i] = (x1 + (x2 - x1) * fract) * a;
+            phs += inc;
+            phs &= SK_OSC_PHASEMASK;
+        }
+    } else {
+        for (i = 0; i < n; i++) {
+            int pos;
+            SKFLT x1, x2, fract;
+
+            pos = phs >> nlb;
+            x1 = tab[pos];
+            x2 = tab[(pos + 1) % sz];
+            fract = (phs & mask) * inlb;
+            out[i] = (x1 + (x2 - x1) * fract) * amp[i];
+            phs += inc;
+            phs &= SK_OSC_PHASEMASK;
+        }
+
+        if (n > 0) osc->amp = amp[n - 1];
+    }
+
+    osc->lphs = phs;
+}
+#line 489 "osc.org"
+        return;
+    }
+
+    if (amp == NULL) {
+        for (i = 0; i < n; i++) {
+            osc->freq = freq[i];
+            out[i] = sk_osc_tick(osc);
+        }
+        return;
+    }
+
+    for (i = 0; i < n; i++) {
+        osc->freq = freq[i];
+        osc->amp = amp[i];
+        out[i] = sk_osc_tick(osc);
+    }
+}
+#line 44 "osc.org"
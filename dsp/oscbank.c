@@ -0,0 +1,184 @@
+#line 50 "oscbank.org"
+#include <stdint.h>
+#include <stdlib.h>
+#define SK_OSCBANK_PRIV
+#include "oscbank.h"
+#include "osc.h"
+
+#line 91 "oscbank.org"
+#define SK_OSCBANK_MAXLEN 0x1000000L
+#define SK_OSCBANK_PHASEMASK 0x0FFFFFFL
+#line 223 "oscbank.org"
+#define SK_OSCBANK_CHUNK 64
+#line 50 "oscbank.org"
+#line 294 "oscbank.org"
+static void voice_held(sk_oscbank *ob,
+                       int v,
+                       int n,
+                       const SKFLT *amp,
+                       SKFLT *sum)
+{
+    SKFLT y[SK_OSCBANK_CHUNK];
+    const SKFLT *tab;
+    uint32_t phs, inc;
+    uint32_t nlb, mask, wrap;
+    SKFLT inlb;
+    SKFLT a;
+    int k;
+
+    tab = ob->tab;
+    nlb = ob->nlb;
+    mask = ob->mask;
+    inlb = ob->inlb;
+    wrap = ob->sz - 1;
+    phs = ob->phs[v];
+    inc = (int32_t)sk_osc_rintf(ob->freq[v] * ob->maxlens);
+
+    for (k = 0; k < n; k++) {
+        uint32_t p;
+        int32_t pos;
+        SKFLT x1, x2;
+
+        p = (phs + k * inc) & SK_OSCBANK_PHASEMASK;
+        pos = p >> nlb;
+        x1 = tab[pos];
+        x2 = tab[(pos + 1) & wrap];
+        y[k] = x1 + (x2 - x1) * ((p & mask) * inlb);
+    }
+
+    if (amp == NULL) {
+        a = ob->amp[v];
+        for (k = 0; k < n; k++) sum[k] += y[k] * a;
+    } else {
+        for (k = 0; k < n; k++) sum[k] += y[k] * amp[k];
+    }
+
+    ob->phs[v] = (phs + n * inc) & SK_OSCBANK_PHASEMASK;
+}
+#line 345 "oscbank.org"
+static void voice_moving(sk_oscbank *ob,
+                         int v,
+                         int n,
+                         const SKFLT *freq,
+                         const SKFLT *amp,
+                         SKFLT *sum)
+{
+    uint32_t phs, pos;
+    SKFLT x1, x2;
+    SKFLT a;
+    int k;
+
+    phs = ob->phs[v];
+
+    for (k = 0; k < n; k++) {
+        a = amp == NULL ? ob->amp[v] : amp[k];
+        pos = phs >> ob->nlb;
+        x1 = ob->tab[pos];
+        x2 = ob->tab[(pos + 1) & (ob->sz - 1)];
+        sum[k] += (x1 + (x2 - x1) * ((phs & ob->mask) * ob->inlb)) * a;
+        phs += (int32_t)sk_osc_rintf(freq[k] * ob->maxlens);
+        phs &= SK_OSCBANK_PHASEMASK;
+    }
+
+    ob->phs[v] = phs;
+}
+#line 50 "oscbank.org"
+#line 113 "oscbank.org"
+void sk_oscbank_init(sk_oscbank *ob,
+                     int sr,
+                     SKFLT *wt,
+                     int sz,
+                     int nvoices)
+{
+    uint32_t tmp;
+    int v;
+
+    if (nvoices < 0) nvoices = 0;
+    if (nvoices > SK_OSCBANK_MAX) nvoices = SK_OSCBANK_MAX;
+
+    ob->tab = wt;
+    ob->sz = sz;
+    ob->nvoices = nvoices;
+
+    tmp = SK_OSCBANK_MAXLEN / sz;
+    ob->nlb = 0;
+    while (tmp >>= 1) ob->nlb++;
+
+    ob->mask = (1<<ob->nlb) - 1;
+    ob->inlb = 1.0 / (1<<ob->nlb);
+    ob->maxlens = 1.0 * SK_OSCBANK_MAXLEN / sr;
+
+    for (v = 0; v < SK_OSCBANK_MAX; v++) {
+        ob->freq[v] = 0;
+        ob->amp[v] = 0;
+        ob->phs[v] = 0;
+    }
+}
+#line 158 "oscbank.org"
+void sk_oscbank_freq(sk_oscbank *ob, int v, SKFLT freq)
+{
+    if (v < 0 || v >= ob->nvoices) return;
+    ob->freq[v] = freq;
+}
+
+void sk_oscbank_amp(sk_oscbank *ob, int v, SKFLT amp)
+{
+    if (v < 0 || v >= ob->nvoices) return;
+    ob->amp[v] = amp;
+}
+
+void sk_oscbank_phase(sk_oscbank *ob, int v, SKFLT phs)
+{
+    if (v < 0 || v >= ob->nvoices) return;
+    ob->phs[v] = ((int32_t)(phs * SK_OSCBANK_MAXLEN)) &
+        SK_OSCBANK_PHASEMASK;
+}
+#line 187 "oscbank.org"
+int sk_oscbank_nvoices(sk_oscbank *ob)
+{
+    return ob->nvoices;
+}
+#line 228 "oscbank.org"
+void sk_oscbank_compute(sk_oscbank *ob,
+                        int n,
+                        const SKFLT **freq,
+                        const SKFLT **amp,
+                        SKFLT *out)
+{
+    SKFLT sum[SK_OSCBANK_CHUNK];
+    const SKFLT *f, *a;
+    int pos;
+    int len;
+    int v;
+    int k;
+
+    for (pos = 0; pos < n; pos += len) {
+        len = n - pos;
+        if (len > SK_OSCBANK_CHUNK) len = SK_OSCBANK_CHUNK;
+
+        for (k = 0; k < len; k++) sum[k] = 0;
+
+        for (v = 0; v < ob->nvoices; v++) {
+            f = freq == NULL || freq[v] == NULL ? NULL : freq[v] + pos;
+            a = amp == NULL || amp[v] == NULL ? NULL : amp[v] + pos;
+
+            if (f == NULL) voice_held(ob, v, len, a, sum);
+            else voice_moving(ob, v, len, f, a, sum);
+        }
+
+        for (k = 0; k < len; k++) out[pos + k] = sum[k];
+    }
+
+    if (n <= 0) return;
+
+    for (v = 0; v < ob->nvoices; v++) {
+        if (freq != NULL && freq[v] != NULL) {
+            ob->freq[v] = freq[v][n - 1];
+        }
+
+        if (amp != NULL && amp[v] != NULL) {
+            ob->amp[v] = amp[v][n - 1];
+        }
+    }
+}
+#line 50 "oscbank.org"
@@ -0,0 +1,51 @@
+#line 29 "oscbank.org"
+#ifndef SK_OSCBANK_H
+#define SK_OSCBANK_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#define SK_OSCBANK_MAX 64
+
+#line 63 "oscbank.org"
+typedef struct sk_oscbank sk_oscbank;
+#line 39 "oscbank.org"
+
+#ifdef SK_OSCBANK_PRIV
+#line 75 "oscbank.org"
+struct sk_oscbank {
+    SKFLT *tab;
+    uint32_t sz;
+    uint32_t nlb;
+    uint32_t mask;
+    SKFLT inlb;
+    SKFLT maxlens;
+    int nvoices;
+    SKFLT freq[SK_OSCBANK_MAX];
+    SKFLT amp[SK_OSCBANK_MAX];
+    uint32_t phs[SK_OSCBANK_MAX];
+};
+#line 42 "oscbank.org"
+#endif
+
+#line 104 "oscbank.org"
+void sk_oscbank_init(sk_oscbank *ob,
+                     int sr,
+                     SKFLT *wt,
+                     int sz,
+                     int nvoices);
+#line 151 "oscbank.org"
+void sk_oscbank_freq(sk_oscbank *ob, int v, SKFLT freq);
+void sk_oscbank_amp(sk_oscbank *ob, int v, SKFLT amp);
+void sk_oscbank_phase(sk_oscbank *ob, int v, SKFLT phs);
+#line 182 "oscbank.org"
+int sk_oscbank_nvoices(sk_oscbank *ob);
+#line 203 "oscbank.org"
+void sk_oscbank_compute(sk_oscbank *ob,
+                        int n,
+                        const SKFLT **freq,
+                        const SKFLT **amp,
+                        SKFLT *out);
+#line 45 "oscbank.org"
+#endif
@@ -0,0 +1,197 @@
+#line 36 "oscf.org"
+#include <math.h>
+#include <stddef.h>
+#define SK_OSCF_PRIV
+#include "oscf.h"
+#line 129 "oscf.org"
+void sk_oscf_init(sk_oscf *oscf,
+                  unsigned int sr,
+                  SKFLT *tab,
+                  unsigned long sz,
+                  SKFLT iphs)
+{
+#line 70 "oscf.org"
+oscf->phs = iphs;
+#line 83 "oscf.org"
+oscf->inc = 0;
+#line 97 "oscf.org"
+oscf->tab = tab;
+oscf->sz = sz;
+#line 111 "oscf.org"
+oscf->sr = sr;
+#line 165 "oscf.org"
+sk_oscf_freq(oscf, 440);
+oscf->lfreq = -1;
+#line 136 "oscf.org"
+}
+#line 148 "oscf.org"
+void sk_oscf_freq(sk_oscf *oscf, SKFLT freq)
+{
+    oscf->freq = freq;
+}
+#line 178 "oscf.org"
+SKFLT sk_oscf_tick(sk_oscf *oscf)
+{
+    SKFLT out;
+    unsigned long ipos;
+    SKFLT fpos;
+    SKFLT x[2];
+    SKFLT phs;
+
+    phs = oscf->phs;
+
+#line 225 "oscf.org"
+if (oscf->lfreq != oscf->freq) {
+    oscf->lfreq = oscf->freq;
+
+    oscf->inc = oscf->freq / (SKFLT)oscf->sr;
+}
+#line 178 "oscf.org"
+#line 242 "oscf.org"
+fpos = phs * oscf->sz;
+ipos = floor(fpos);
+fpos = fpos - ipos;
+#line 178 "oscf.org"
+#line 257 "oscf.org"
+x[0] = oscf->tab[ipos];
+
+if (ipos >= (oscf->sz - 1)) {
+    x[1] = oscf->tab[0];
+} else {
+    x[1] = oscf->tab[ipos + 1];
+}
+#line 178 "oscf.org"
+#line 271 "oscf.org"
+out = fpos * x[1] + (1 - fpos) * x[0];
+#line 178 "oscf.org"
+#line 278 "oscf.org"
+phs += oscf->inc;
+#line 178 "oscf.org"
+#line 292 "oscf.org"
+while (phs >= 1) phs--;
+while (phs < 0) phs++;
+#line 194 "oscf.org"
+
+    oscf->phs = phs;
+
+    return out;
+}
+#line 317 "oscf.org"
+SKFLT sk_oscf_tick_extphs(sk_oscf *oscf, SKFLT phs)
+{
+    SKFLT out;
+    unsigned long ipos;
+    SKFLT fpos;
+    SKFLT x[2];
+
+    out = 0;
+
+#line 292 "oscf.org"
+while (phs >= 1) phs--;
+while (phs < 0) phs++;
+#line 317 "oscf.org"
+#line 225 "oscf.org"
+if (oscf->lfreq != oscf->freq) {
+    oscf->lfreq = oscf->freq;
+
+    oscf->inc = oscf->freq / (SKFLT)oscf->sr;
+}
+#line 317 "oscf.org"
+#line 242 "oscf.org"
+fpos = phs * oscf->sz;
+ipos = floor(fpos);
+fpos = fpos - ipos;
+#line 317 "oscf.org"
+#line 257 "oscf.org"
+x[0] = oscf->tab[ipos];
+
+if (ipos >= (oscf->sz - 1)) {
+    x[1] = oscf->tab[0];
+} else {
+    x[1] = oscf->tab[ipos + 1];
+}
+#line 317 "oscf.org"
+#line 271 "oscf.org"
+out = fpos * x[1] + (1 - fpos) * x[0];
+#line 331 "oscf.org"
+
+    return out;
+}
+#line 358 "oscf.org"
+void sk_oscf_compute(sk_oscf *oscf,
+                     int n,
+                     const SKFLT *freq,
+                     SKFLT *out)
+{
+    int i;
+
+    if (freq == NULL) {
+#line 397 "oscf.org"
+{
+    SKFLT phs, inc;
+    SKFLT *tab;
+    unsigned long sz;
+
+#line 225 "oscf.org"
+if (oscf->lfreq != oscf->freq) {
+    oscf->lfreq = oscf->freq;
+
+    oscf->inc = oscf->freq / (SKFLT)oscf->sr;
+}
+#line 403 "oscf.org"
+
+    phs = oscf->phs;
+    inc = oscf->inc;
+    tab = oscf->tab;
+    sz = oscf->sz;
+
+    for (i = 0; i < n; i++) {
+        unsigned long ipos;
+        SKFLT fpos;
+        SKFLT x[2];
+
+        fpos = phs * sz;
+        ipos = floor(fpos);
+        fpos = fpos - ipos;
+
+        x[0] = tab[ipos];
+
+        if (ipos >= (sz - 1)) {
+            x[1] = tab[0];
+        } else {
+            x[1] = tab[ipos + 1];
+        }
+
+        out[i] = fpos * x[1] + (1 - fpos) * x[0];
+
+        phs += inc;
+#line 292 "oscf.org"
+while (phs >= 1) phs--;
+while (phs < 0) phs++;
+#line 430 "oscf.org"
+    }
+
+    oscf->phs = phs;
+}
+#line 367 "oscf.org"
+        return;
+    }
+
+    for (i = 0; i < n; i++) {
+        oscf->freq = freq[i];
+        out[i] = sk_oscf_tick(oscf);
+    }
+}
+
+void sk_oscf_compute_extphs(sk_oscf *oscf,
+                            int n,
+                            const SKFLT *phs,
+                            SKFLT *out)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        out[i] = sk_oscf_tick_extphs(oscf, phs[i]);
+    }
+}
+#line 36 "oscf.org"
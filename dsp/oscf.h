@@ -0,0 +1,51 @@
+#line 21 "oscf.org"
+#ifndef SK_OSCF_H
+#define SK_OSCF_H
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 47 "oscf.org"
+typedef struct sk_oscf sk_oscf;
+#line 21 "oscf.org"
+#line 120 "oscf.org"
+void sk_oscf_init(sk_oscf *oscf,
+                  unsigned int sr,
+                  SKFLT *tab,
+                  unsigned long sz,
+                  SKFLT iphs);
+#line 143 "oscf.org"
+void sk_oscf_freq(sk_oscf *oscf, SKFLT freq);
+#line 173 "oscf.org"
+SKFLT sk_oscf_tick(sk_oscf *oscf);
+#line 306 "oscf.org"
+SKFLT sk_oscf_tick_extphs(sk_oscf *oscf, SKFLT phs);
+#line 346 "oscf.org"
+void sk_oscf_compute(sk_oscf *oscf,
+                     int n,
+                     const SKFLT *freq,
+                     SKFLT *out);
+void sk_oscf_compute_extphs(sk_oscf *oscf,
+                            int n,
+                            const SKFLT *phs,
+                            SKFLT *out);
+#line 28 "oscf.org"
+#ifdef SK_OSCF_PRIV
+#line 52 "oscf.org"
+struct sk_oscf {
+#line 65 "oscf.org"
+SKFLT phs;
+#line 78 "oscf.org"
+SKFLT inc;
+#line 91 "oscf.org"
+SKFLT *tab;
+unsigned long sz;
+#line 106 "oscf.org"
+unsigned int sr;
+#line 159 "oscf.org"
+SKFLT freq;
+SKFLT lfreq;
+#line 54 "oscf.org"
+};
+#line 30 "oscf.org"
+#endif
+#endif
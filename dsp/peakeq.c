@@ -0,0 +1,147 @@
+#line 77 "peakeq.org"
+#include <math.h>
+#include <stddef.h>
+#define SK_PEAKEQ_PRIV
+#include "peakeq.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#line 134 "peakeq.org"
+void sk_peakeq_init(sk_peakeq *eq, int sr)
+{
+#line 153 "peakeq.org"
+eq->v[0] = 0;
+eq->v[1] = 0;
+#line 168 "peakeq.org"
+eq->a = 0;
+eq->b = 0;
+#line 182 "peakeq.org"
+eq->sr = sr;
+#line 216 "peakeq.org"
+sk_peakeq_freq(eq, 1000);
+eq->pfreq = -1;
+#line 250 "peakeq.org"
+sk_peakeq_bandwidth(eq, 1000);
+eq->pbw = -1;
+#line 277 "peakeq.org"
+sk_peakeq_gain(eq, 1.0);
+#line 137 "peakeq.org"
+}
+#line 196 "peakeq.org"
+void sk_peakeq_freq(sk_peakeq *eq, SKFLT freq)
+{
+    eq->freq = freq;
+}
+#line 230 "peakeq.org"
+void sk_peakeq_bandwidth(sk_peakeq *eq, SKFLT bw)
+{
+    eq->bw = bw;
+}
+#line 264 "peakeq.org"
+void sk_peakeq_gain(sk_peakeq *eq, SKFLT gain)
+{
+    eq->gain = gain;
+}
+#line 289 "peakeq.org"
+SKFLT sk_peakeq_tick(sk_peakeq *eq, SKFLT in)
+{
+    SKFLT out;
+    SKFLT v;
+    SKFLT y;
+    out = 0;
+
+#line 318 "peakeq.org"
+if (eq->bw != eq->pbw || eq->freq != eq->pfreq) {
+    SKFLT c;
+    eq->b = -cos(2 * M_PI * eq->freq / eq->sr);
+    c = tan(M_PI * eq->bw / eq->sr);
+    eq->a = (1.0 - c) / (1.0 + c);
+
+    eq->pbw = eq->bw;
+    eq->pfreq = eq->freq;
+}
+#line 289 "peakeq.org"
+#line 336 "peakeq.org"
+v = in - eq->b*(1.0 + eq->a)*eq->v[0] - eq->a*eq->v[1];
+y = eq->a*v + eq->b*(1.0 + eq->a)*eq->v[0] + eq->v[1];
+#line 289 "peakeq.org"
+#line 350 "peakeq.org"
+out = ((in + y) + eq->gain*(in - y)) * 0.5;
+#line 289 "peakeq.org"
+#line 362 "peakeq.org"
+eq->v[1] = eq->v[0];
+eq->v[0] = v;
+#line 300 "peakeq.org"
+
+    return out;
+}
+#line 391 "peakeq.org"
+void sk_peakeq_compute(sk_peakeq *eq,
+                       int n,
+                       const SKFLT *freq,
+                       const SKFLT *bw,
+                       const SKFLT *gain,
+                       const SKFLT *in,
+                       SKFLT *out)
+{
+    int i;
+    int fs, bs, gs;
+
+    if (freq == NULL && bw == NULL && gain == NULL) {
+#line 428 "peakeq.org"
+{
+    SKFLT a, g;
+    double ba;
+    SKFLT v0, v1;
+
+#line 318 "peakeq.org"
+if (eq->bw != eq->pbw || eq->freq != eq->pfreq) {
+    SKFLT c;
+    eq->b = -cos(2 * M_PI * eq->freq / eq->sr);
+    c = tan(M_PI * eq->bw / eq->sr);
+    eq->a = (1.0 - c) / (1.0 + c);
+
+    eq->pbw = eq->bw;
+    eq->pfreq = eq->freq;
+}
+#line 434 "peakeq.org"
+
+    a = eq->a;
+    ba = eq->b*(1.0 + eq->a);
+    g = eq->gain;
+    v0 = eq->v[0];
+    v1 = eq->v[1];
+
+    for (i = 0; i < n; i++) {
+        SKFLT x, v, y;
+
+        x = in[i];
+        v = x - ba*v0 - a*v1;
+        y = a*v + ba*v0 + v1;
+        out[i] = ((x + y) + g*(x - y)) * 0.5;
+        v1 = v0;
+        v0 = v;
+    }
+
+    eq->v[0] = v0;
+    eq->v[1] = v1;
+}
+#line 404 "peakeq.org"
+        return;
+    }
+
+    fs = bs = gs = 1;
+    if (freq == NULL) {freq = &eq->freq; fs = 0;}
+    if (bw == NULL) {bw = &eq->bw; bs = 0;}
+    if (gain == NULL) {gain = &eq->gain; gs = 0;}
+
+    for (i = 0; i < n; i++) {
+        sk_peakeq_freq(eq, freq[i * fs]);
+        sk_peakeq_bandwidth(eq, bw[i * bs]);
+        sk_peakeq_gain(eq, gain[i * gs]);
+        out[i] = sk_peakeq_tick(eq, in[i]);
+    }
+}
+#line 77 "peakeq.org"
@@ -0,0 +1,54 @@
+#line 94 "peakeq.org"
+#ifndef SK_PEAKEQ_H
+#define SK_PEAKEQ_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#line 114 "peakeq.org"
+typedef struct sk_peakeq sk_peakeq;
+#line 94 "peakeq.org"
+#line 129 "peakeq.org"
+void sk_peakeq_init(sk_peakeq *eq, int sr);
+#line 191 "peakeq.org"
+void sk_peakeq_freq(sk_peakeq *eq, SKFLT freq);
+#line 225 "peakeq.org"
+void sk_peakeq_bandwidth(sk_peakeq *eq, SKFLT bw);
+#line 259 "peakeq.org"
+void sk_peakeq_gain(sk_peakeq *eq, SKFLT gain);
+#line 284 "peakeq.org"
+SKFLT sk_peakeq_tick(sk_peakeq *eq, SKFLT in);
+#line 380 "peakeq.org"
+void sk_peakeq_compute(sk_peakeq *eq,
+                       int n,
+                       const SKFLT *freq,
+                       const SKFLT *bw,
+                       const SKFLT *gain,
+                       const SKFLT *in,
+                       SKFLT *out);
+#line 103 "peakeq.org"
+
+#ifdef SK_PEAKEQ_PRIV
+#line 119 "peakeq.org"
+struct sk_peakeq {
+#line 148 "peakeq.org"
+SKFLT v[2];
+#line 162 "peakeq.org"
+SKFLT a;
+SKFLT b;
+#line 177 "peakeq.org"
+int sr;
+#line 207 "peakeq.org"
+SKFLT freq;
+SKFLT pfreq;
+#line 241 "peakeq.org"
+SKFLT bw;
+SKFLT pbw;
+#line 272 "peakeq.org"
+SKFLT gain;
+#line 121 "peakeq.org"
+};
+#line 106 "peakeq.org"
+#endif
+#endif
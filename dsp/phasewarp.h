@@ -0,0 +1,12 @@
+#line 32 "phasewarp.org"
+#ifndef SK_PHASEWARP_H
+#define SK_PHASEWARP_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#line 49 "phasewarp.org"
+SKFLT sk_phasewarp_tick(SKFLT in, SKFLT warp);
+#line 40 "phasewarp.org"
+#endif
@@ -0,0 +1,12 @@
+#line 12 "scale.org"
+#ifndef SK_SCALE_H
+#define SK_SCALE_H
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 32 "scale.org"
+SKFLT sk_scale(SKFLT in, SKFLT min, SKFLT max);
+#line 49 "scale.org"
+SKFLT sk_biscale(SKFLT in, SKFLT min, SKFLT max);
+#line 18 "scale.org"
+#endif
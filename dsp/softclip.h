@@ -0,0 +1,10 @@
+#line 22 "softclip.org"
+#ifndef SK_SOFTCLIP_H
+#define SK_SOFTCLIP_H
+#ifndef SKFLT
+#define SKFLT float
+#endif
+#line 39 "softclip.org"
+SKFLT sk_softclip_tick(SKFLT in, SKFLT drive);
+#line 28 "softclip.org"
+#endif
@@ -0,0 +1,395 @@
+#line 52 "sosbank.org"
+#include <math.h>
+#define SK_SOSBANK_PRIV
+#include "sosbank.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#line 516 "sosbank.org"
+struct lanes {
+    SKFLT b0[SK_SOSBANK_LANES];
+    SKFLT b1[SK_SOSBANK_LANES];
+    SKFLT b2[SK_SOSBANK_LANES];
+    SKFLT a1[SK_SOSBANK_LANES];
+    SKFLT a2[SK_SOSBANK_LANES];
+    SKFLT z1[SK_SOSBANK_LANES];
+    SKFLT z2[SK_SOSBANK_LANES];
+    SKFLT x[SK_SOSBANK_LANES];
+    SKFLT y[SK_SOSBANK_LANES];
+};
+
+static void compute_group(sk_sosbank *sb,
+                          int g,
+                          int n,
+                          const SKFLT *in,
+                          SKFLT *out);
+#line 52 "sosbank.org"
+#line 100 "sosbank.org"
+void sk_sosbank_init(sk_sosbank *sb, int sr)
+{
+    int s;
+
+    sb->sr = sr;
+    sb->nsections = 0;
+
+    for (s = 0; s < SK_SOSBANK_MAX; s++) {
+        sk_sosbank_set(sb, s, 1, 0, 0, 0, 0);
+        sb->z1[s] = 0;
+        sb->z2[s] = 0;
+    }
+}
+#line 127 "sosbank.org"
+void sk_sosbank_nsections(sk_sosbank *sb, int nsections)
+{
+    int s;
+
+    if (nsections < 0) nsections = 0;
+    if (nsections > SK_SOSBANK_MAX) nsections = SK_SOSBANK_MAX;
+
+    for (s = sb->nsections; s < nsections; s++) {
+        sb->z1[s] = 0;
+        sb->z2[s] = 0;
+    }
+
+    for (s = nsections; s < sb->nsections; s++) {
+        sk_sosbank_set(sb, s, 1, 0, 0, 0, 0);
+        sb->z1[s] = 0;
+        sb->z2[s] = 0;
+    }
+
+    sb->nsections = nsections;
+}
+#line 162 "sosbank.org"
+void sk_sosbank_set(sk_sosbank *sb, int s,
+                    SKFLT b0, SKFLT b1, SKFLT b2,
+                    SKFLT a1, SKFLT a2)
+{
+    if (s < 0 || s >= SK_SOSBANK_MAX) return;
+    sb->b0[s] = b0;
+    sb->b1[s] = b1;
+    sb->b2[s] = b2;
+    sb->a1[s] = a1;
+    sb->a2[s] = a2;
+}
+#line 190 "sosbank.org"
+void sk_sosbank_lowpass(sk_sosbank *sb, int s,
+                        SKFLT freq, SKFLT q)
+{
+    double w, cs, alpha, ia0;
+
+    w = 2.0 * M_PI * freq / sb->sr;
+    cs = cos(w);
+    alpha = sin(w) / (2.0 * q);
+    ia0 = 1.0 / (1.0 + alpha);
+
+    sk_sosbank_set(sb, s,
+                   (1.0 - cs) * 0.5 * ia0,
+                   (1.0 - cs) * ia0,
+                   (1.0 - cs) * 0.5 * ia0,
+                   -2.0 * cs * ia0,
+                   (1.0 - alpha) * ia0);
+}
+
+void sk_sosbank_highpass(sk_sosbank *sb, int s,
+                         SKFLT freq, SKFLT q)
+{
+    double w, cs, alpha, ia0;
+
+    w = 2.0 * M_PI * freq / sb->sr;
+    cs = cos(w);
+    alpha = sin(w) / (2.0 * q);
+    ia0 = 1.0 / (1.0 + alpha);
+
+    sk_sosbank_set(sb, s,
+                   (1.0 + cs) * 0.5 * ia0,
+                   -(1.0 + cs) * ia0,
+                   (1.0 + cs) * 0.5 * ia0,
+                   -2.0 * cs * ia0,
+                   (1.0 - alpha) * ia0);
+}
+#line 238 "sosbank.org"
+void sk_sosbank_lowpass1(sk_sosbank *sb, int s, SKFLT freq)
+{
+    double k;
+
+    k = tan(M_PI * freq / sb->sr);
+    sk_sosbank_set(sb, s,
+                   k / (1.0 + k), k / (1.0 + k), 0,
+                   (k - 1.0) / (k + 1.0), 0);
+}
+
+void sk_sosbank_highpass1(sk_sosbank *sb, int s, SKFLT freq)
+{
+    double k;
+
+    k = tan(M_PI * freq / sb->sr);
+    sk_sosbank_set(sb, s,
+                   1.0 / (1.0 + k), -1.0 / (1.0 + k), 0,
+                   (k - 1.0) / (k + 1.0), 0);
+}
+#line 285 "sosbank.org"
+static void butterworth(sk_sosbank *sb,
+                        int order,
+                        SKFLT freq,
+                        int hp)
+{
+    int npairs;
+    int s;
+    int k;
+    double q;
+
+    if (order < 1) order = 1;
+    if (order > 2 * SK_SOSBANK_MAX) order = 2 * SK_SOSBANK_MAX;
+
+    npairs = order / 2;
+    s = 0;
+
+    if (order % 2) {
+        if (hp) sk_sosbank_highpass1(sb, s, freq);
+        else sk_sosbank_lowpass1(sb, s, freq);
+        s++;
+    }
+
+    for (k = npairs - 1; k >= 0; k--) {
+        q = 1.0 / (2.0 * sin((2 * k + 1) * M_PI / (2.0 * order)));
+        if (hp) sk_sosbank_highpass(sb, s, freq, q);
+        else sk_sosbank_lowpass(sb, s, freq, q);
+        s++;
+    }
+
+    sk_sosbank_nsections(sb, s);
+}
+
+void sk_sosbank_butlp(sk_sosbank *sb, int order, SKFLT freq)
+{
+    butterworth(sb, order, freq, 0);
+}
+
+void sk_sosbank_buthp(sk_sosbank *sb, int order, SKFLT freq)
+{
+    butterworth(sb, order, freq, 1);
+}
+#line 350 "sosbank.org"
+void sk_sosbank_peak(sk_sosbank *sb, int s,
+                     SKFLT freq, SKFLT bw, SKFLT gain)
+{
+    double a, b, c, g;
+
+    g = pow(10.0, gain / 20.0);
+    b = -cos(2.0 * M_PI * freq / sb->sr);
+    c = tan(M_PI * bw / sb->sr);
+    a = (1.0 - c) / (1.0 + c);
+    c = b * (1.0 + a);
+
+    sk_sosbank_set(sb, s,
+                   ((1.0 + g) + (1.0 - g) * a) * 0.5,
+                   c,
+                   ((1.0 + g) * a + (1.0 - g)) * 0.5,
+                   c,
+                   a);
+}
+#line 386 "sosbank.org"
+static void shelf(sk_sosbank *sb, int s,
+                  SKFLT freq, SKFLT gain, SKFLT slope,
+                  int high)
+{
+    double A, w, cs, alpha, k, ia0, sg;
+
+    if (slope <= 0) slope = 1;
+
+    A = pow(10.0, gain / 40.0);
+    w = 2.0 * M_PI * freq / sb->sr;
+    alpha = sin(w) * 0.5 *
+        sqrt((A + (1.0/A))*((1.0/slope) - 1.0) + 2.0);
+    cs = cos(w);
+    k = sqrt(A)*alpha*2.0;
+
+    /* the high shelf is the low shelf with cos flipped */
+    sg = high ? -1.0 : 1.0;
+
+    ia0 = 1.0 / ((A+1.0) + sg*(A-1.0)*cs + k);
+
+    sk_sosbank_set(sb, s,
+                   A*((A+1.0) - sg*(A-1.0)*cs + k) * ia0,
+                   sg*2.0*A*((A-1.0) - sg*(A+1.0)*cs) * ia0,
+                   A*((A+1.0) - sg*(A-1.0)*cs - k) * ia0,
+                   -sg*2.0*((A-1.0) + sg*(A+1.0)*cs) * ia0,
+                   ((A+1.0) + sg*(A-1.0)*cs - k) * ia0);
+}
+
+void sk_sosbank_lowshelf(sk_sosbank *sb, int s,
+                         SKFLT freq, SKFLT gain, SKFLT slope)
+{
+    shelf(sb, s, freq, gain, slope, 0);
+}
+
+void sk_sosbank_highshelf(sk_sosbank *sb, int s,
+                          SKFLT freq, SKFLT gain, SKFLT slope)
+{
+    shelf(sb, s, freq, gain, slope, 1);
+}
+#line 438 "sosbank.org"
+SKFLT sk_sosbank_tick(sk_sosbank *sb, SKFLT in)
+{
+    int s;
+    SKFLT y;
+
+    for (s = 0; s < sb->nsections; s++) {
+        y = sb->b0[s]*in + sb->z1[s];
+        sb->z1[s] = sb->b1[s]*in - sb->a1[s]*y + sb->z2[s];
+        sb->z2[s] = sb->b2[s]*in - sb->a2[s]*y;
+        in = y;
+    }
+
+    return in;
+}
+#line 482 "sosbank.org"
+void sk_sosbank_compute(sk_sosbank *sb,
+                        int n,
+                        const SKFLT *in,
+                        SKFLT *out)
+{
+    int g;
+    int j;
+
+    if (sb->nsections == 0) {
+        for (j = 0; j < n; j++) out[j] = in[j];
+        return;
+    }
+
+    for (g = 0; g < sb->nsections; g += SK_SOSBANK_LANES) {
+        compute_group(sb, g, n, g == 0 ? in : out, out);
+    }
+}
+#line 544 "sosbank.org"
+static void partial_step(struct lanes *l, int lo, int hi, SKFLT in)
+{
+    int s;
+    SKFLT v, x;
+
+    if (lo < 0) lo = 0;
+
+    for (s = hi; s >= lo; s--) {
+        x = s == 0 ? in : l->y[s - 1];
+        v = l->b0[s]*x + l->z1[s];
+        l->z1[s] = l->b1[s]*x - l->a1[s]*v + l->z2[s];
+        l->z2[s] = l->b2[s]*x - l->a2[s]*v;
+        l->y[s] = v;
+    }
+}
+
+#line 578 "sosbank.org"
+#if (defined(__clang__) || __GNUC__ >= 12) && SK_SOSBANK_LANES == 4
+__extension__
+typedef SKFLT lanevec
+    __attribute__((vector_size(SK_SOSBANK_LANES * sizeof(SKFLT))));
+
+static void full_steps(struct lanes *l,
+                       int n,
+                       const SKFLT *in,
+                       SKFLT *out)
+{
+    lanevec b0, b1, b2, a1, a2, z1, z2, x, y, v;
+    int j;
+    int s;
+
+    for (s = 0; s < SK_SOSBANK_LANES; s++) {
+        b0[s] = l->b0[s];
+        b1[s] = l->b1[s];
+        b2[s] = l->b2[s];
+        a1[s] = l->a1[s];
+        a2[s] = l->a2[s];
+        z1[s] = l->z1[s];
+        z2[s] = l->z2[s];
+        y[s] = l->y[s];
+    }
+
+    for (j = 0; j < n; j++) {
+        x = __builtin_shufflevector(y, y, 0, 0, 1, 2);
+        x[0] = in[j];
+        v = b0*x + z1;
+        z1 = b1*x - a1*v + z2;
+        z2 = b2*x - a2*v;
+        y = v;
+        out[j] = y[SK_SOSBANK_LANES - 1];
+    }
+
+    for (s = 0; s < SK_SOSBANK_LANES; s++) {
+        l->z1[s] = z1[s];
+        l->z2[s] = z2[s];
+        l->y[s] = y[s];
+    }
+}
+#else
+static void full_steps(struct lanes *l,
+                       int n,
+                       const SKFLT *in,
+                       SKFLT *out)
+{
+    int j;
+    int s;
+
+    for (j = 0; j < n; j++) {
+        for (s = 1; s < SK_SOSBANK_LANES; s++) l->x[s] = l->y[s - 1];
+        l->x[0] = in[j];
+
+        for (s = 0; s < SK_SOSBANK_LANES; s++) {
+            SKFLT v;
+            v = l->b0[s]*l->x[s] + l->z1[s];
+            l->z1[s] = l->b1[s]*l->x[s] - l->a1[s]*v + l->z2[s];
+            l->z2[s] = l->b2[s]*l->x[s] - l->a2[s]*v;
+            l->y[s] = v;
+        }
+
+        out[j] = l->y[SK_SOSBANK_LANES - 1];
+    }
+}
+#endif
+#line 651 "sosbank.org"
+static void compute_group(sk_sosbank *sb,
+                          int g,
+                          int n,
+                          const SKFLT *in,
+                          SKFLT *out)
+{
+    struct lanes l;
+    int last;
+    int j;
+    int s;
+
+    if (n <= 0) return;
+
+    last = SK_SOSBANK_LANES - 1;
+
+    for (s = 0; s < SK_SOSBANK_LANES; s++) {
+        l.b0[s] = sb->b0[g + s];
+        l.b1[s] = sb->b1[g + s];
+        l.b2[s] = sb->b2[g + s];
+        l.a1[s] = sb->a1[g + s];
+        l.a2[s] = sb->a2[g + s];
+        l.z1[s] = sb->z1[g + s];
+        l.z2[s] = sb->z2[g + s];
+        l.x[s] = l.y[s] = 0;
+    }
+
+    /* filling up */
+    for (j = 0; j < last; j++) {
+        partial_step(&l, j - n + 1, j, j < n ? in[j] : 0);
+    }
+
+    if (n > last) full_steps(&l, n - last, in + last, out);
+
+    /* draining */
+    for (j = n > last ? n : last; j < n + last; j++) {
+        partial_step(&l, j - n + 1, last, 0);
+        out[j - last] = l.y[last];
+    }
+
+    for (s = 0; s < SK_SOSBANK_LANES; s++) {
+        sb->z1[g + s] = l.z1[s];
+        sb->z2[g + s] = l.z2[s];
+    }
+}
+#line 52 "sosbank.org"
@@ -0,0 +1,68 @@
+#line 31 "sosbank.org"
+#ifndef SK_SOSBANK_H
+#define SK_SOSBANK_H
+
+#ifndef SKFLT
+#define SKFLT float
+#endif
+
+#define SK_SOSBANK_MAX 16
+
+#line 66 "sosbank.org"
+typedef struct sk_sosbank sk_sosbank;
+#line 41 "sosbank.org"
+
+#ifdef SK_SOSBANK_PRIV
+#line 77 "sosbank.org"
+struct sk_sosbank {
+    int sr;
+    int nsections;
+    SKFLT b0[SK_SOSBANK_MAX];
+    SKFLT b1[SK_SOSBANK_MAX];
+    SKFLT b2[SK_SOSBANK_MAX];
+    SKFLT a1[SK_SOSBANK_MAX];
+    SKFLT a2[SK_SOSBANK_MAX];
+    SKFLT z1[SK_SOSBANK_MAX];
+    SKFLT z2[SK_SOSBANK_MAX];
+};
+#line 477 "sosbank.org"
+#define SK_SOSBANK_LANES 4
+#line 44 "sosbank.org"
+#endif
+
+#line 95 "sosbank.org"
+void sk_sosbank_init(sk_sosbank *sb, int sr);
+#line 122 "sosbank.org"
+void sk_sosbank_nsections(sk_sosbank *sb, int nsections);
+#line 155 "sosbank.org"
+void sk_sosbank_set(sk_sosbank *sb, int s,
+                    SKFLT b0, SKFLT b1, SKFLT b2,
+                    SKFLT a1, SKFLT a2);
+#line 182 "sosbank.org"
+void sk_sosbank_lowpass(sk_sosbank *sb, int s,
+                        SKFLT freq, SKFLT q);
+void sk_sosbank_highpass(sk_sosbank *sb, int s,
+                         SKFLT freq, SKFLT q);
+#line 232 "sosbank.org"
+void sk_sosbank_lowpass1(sk_sosbank *sb, int s, SKFLT freq);
+void sk_sosbank_highpass1(sk_sosbank *sb, int s, SKFLT freq);
+#line 266 "sosbank.org"
+void sk_sosbank_butlp(sk_sosbank *sb, int order, SKFLT freq);
+void sk_sosbank_buthp(sk_sosbank *sb, int order, SKFLT freq);
+#line 344 "sosbank.org"
+void sk_sosbank_peak(sk_sosbank *sb, int s,
+                     SKFLT freq, SKFLT bw, SKFLT gain);
+#line 378 "sosbank.org"
+void sk_sosbank_lowshelf(sk_sosbank *sb, int s,
+                         SKFLT freq, SKFLT gain, SKFLT slope);
+void sk_sosbank_highshelf(sk_sosbank *sb, int s,
+                          SKFLT freq, SKFLT gain, SKFLT slope);
+#line 433 "sosbank.org"
+SKFLT sk_sosbank_tick(sk_sosbank *sb, SKFLT in);
+#line 459 "sosbank.org"
+void sk_sosbank_compute(sk_sosbank *sb,
+                        int n,
+                        const SKFLT *in,
+                        SKFLT *out);
+#line 47 "sosbank.org"
+#endif
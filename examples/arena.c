@@ -0,0 +1,127 @@
+/*
+ * Compares compute time of a ~5k node patch with and
+ * without the node arena.
+ *
+ * On a fresh heap, malloc already hands out memory in
+ * order, and the two come out about the same. So the heap
+ * gets fragmented first, like it would be in a program that
+ * has been running for a while: lots of allocations of
+ * random sizes, with about half of them freed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define NNODES 5000
+#define NJUNK 200000
+
+static void *junk[NJUNK];
+static unsigned long rng = 1;
+
+static unsigned long rnd(void)
+{
+    rng = rng * 1103515245UL + 12345UL;
+    return (rng >> 16) & 0x7fff;
+}
+
+static void fragment(void)
+{
+    int i;
+
+    for (i = 0; i < NJUNK; i++) {
+        junk[i] = malloc(16 + rnd() % 1024);
+    }
+
+    for (i = 0; i < NJUNK; i++) {
+        if (rnd() & 1) {
+            free(junk[i]);
+            junk[i] = NULL;
+        }
+    }
+}
+
+static void unfragment(void)
+{
+    int i;
+
+    for (i = 0; i < NJUNK; i++) {
+        free(junk[i]);
+        junk[i] = NULL;
+    }
+}
+
+static int patch(sk_core *core)
+{
+    int rc;
+    int n;
+
+    rc = sk_core_constant(core, 440);
+    SK_ERROR_CHECK(rc);
+    rc = sk_core_constant(core, 0.5);
+    SK_ERROR_CHECK(rc);
+    rc = sk_node_sine(core);
+    SK_ERROR_CHECK(rc);
+
+    /* a long chain of cheap nodes, so node overhead dominates */
+    for (n = 1; n < NNODES; n++) {
+        rc = sk_core_constant(core, (n & 1) ? 0.999 : 0.001);
+        SK_ERROR_CHECK(rc);
+        if (n & 1) rc = sk_node_mul(core);
+        else rc = sk_node_add(core);
+        SK_ERROR_CHECK(rc);
+    }
+
+    return 0;
+}
+
+static double run(int arena)
+{
+    sk_core *core;
+    unsigned int n;
+    unsigned int nblocks;
+    clock_t start;
+    double secs;
+
+    core = sk_core_new(44100, 64);
+
+    if (arena) sk_core_arena(core, 0);
+
+    fragment();
+
+    if (patch(core)) {
+        fprintf(stderr, "could not build patch\n");
+        sk_core_del(core);
+        unfragment();
+        return -1;
+    }
+
+    nblocks = sk_core_seconds_to_blocks(core, 10);
+
+    start = clock();
+    for (n = 0; n < nblocks; n++) {
+        sk_core_compute(core);
+    }
+    secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    sk_core_del(core);
+    unfragment();
+    return secs;
+}
+
+int main(int argc, char *argv[])
+{
+    double malloced, arena;
+
+    malloced = run(0);
+    arena = run(1);
+
+    printf("%d nodes, 10 seconds of audio, fragmented heap\n", NNODES);
+    printf("malloc: %gs\n", malloced);
+    printf("arena:  %gs\n", arena);
+
+    return 0;
+}
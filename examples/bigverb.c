@@ -0,0 +1,111 @@
+/*
+ * Compares the two ways of running bigverb.
+ *
+ * The same burst of noise goes through one reverb a sample
+ * at a time with sk_bigverb_tick, and through another one
+ * a block at a time with sk_bigverb_compute, which works on
+ * all 8 delay lines at once. Reports the time taken by
+ * each, and the biggest difference between their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#define SK_BIGVERB_PRIV
+#include "dsp/bigverb.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define SECS 60
+
+/* whole blocks */
+#define NBLKS ((SR * SECS + BLKSIZE - 1) / BLKSIZE)
+
+static void input(SKFLT *inL, SKFLT *inR, unsigned long pos)
+{
+    int n;
+
+    for (n = 0; n < BLKSIZE; n++) {
+        /* a short burst every second, so the tail gets used */
+        if ((pos + n) % SR < SR / 10) {
+            inL[n] = (SKFLT)rand() / RAND_MAX - 0.5;
+            inR[n] = (SKFLT)rand() / RAND_MAX - 0.5;
+        } else {
+            inL[n] = inR[n] = 0;
+        }
+    }
+}
+
+static double run(int block, SKFLT *out)
+{
+    sk_bigverb *bv;
+    SKFLT inL[BLKSIZE], inR[BLKSIZE];
+    SKFLT outL[BLKSIZE], outR[BLKSIZE];
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    bv = sk_bigverb_new(SR);
+    sk_bigverb_size(bv, 0.93);
+    sk_bigverb_cutoff(bv, 10000);
+    srand(1);
+
+    end = (unsigned long)NBLKS * BLKSIZE;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        input(inL, inR, pos);
+
+        start = clock();
+
+        if (block) {
+            sk_bigverb_compute(bv, BLKSIZE, NULL, NULL,
+                               inL, inR, outL, outR);
+        } else {
+            for (n = 0; n < BLKSIZE; n++) {
+                sk_bigverb_tick(bv, inL[n], inR[n], &outL[n], &outR[n]);
+            }
+        }
+
+        total += clock() - start;
+
+        for (n = 0; n < BLKSIZE; n++) {
+            out[2*(pos + n)] = outL[n];
+            out[2*(pos + n) + 1] = outR[n];
+        }
+    }
+
+    sk_bigverb_del(bv);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+
+    len = 2 * (unsigned long)NBLKS * BLKSIZE;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("block size %d, %d seconds of audio\n", BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("tick:    %gs\n", ta);
+    tb = run(1, b);
+    printf("compute: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+    }
+    printf("biggest difference: %g\n", diff);
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Compares an ensemble with separate glottis and tract nodes.
+ *
+ * The same choir gets built two ways: as a glottis going into
+ * a tractxyv for every voice, added together, and as one
+ * ensemble node, with the voices in a table. This is done for
+ * 4, 8, and 16 voices. Reports the time taken by each, and
+ * the biggest difference between their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define SECS 10
+
+int sk_node_tractxyv(sk_core *core);
+
+static SKFLT voice(int v, int p)
+{
+    switch (p) {
+        case 0: return 110 * (1 + 0.1 * v);
+        case 1: return 0.5 + 0.03 * v;
+        case 2: return 0.1 + 0.05 * v;
+        case 3: return 0.3 + 0.04 * v;
+        case 4: return (v % 3) == 0 ? 0.5 : 0;
+        default: break;
+    }
+    return 1;
+}
+
+static sk_core *patch(int nvoices, int bank)
+{
+    sk_core *core;
+    int v, p;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    if (bank) {
+        sk_table *tab;
+        SKFLT *data;
+
+        sk_core_table_new(core, 6 * nvoices);
+        sk_core_table_pop(core, &tab);
+        data = sk_table_data(tab);
+        for (v = 0; v < nvoices; v++) {
+            for (p = 0; p < 6; p++) data[6*v + p] = voice(v, p);
+        }
+        sk_core_table_push(core, tab);
+        sk_node_ensemble(core);
+        return core;
+    }
+
+    for (v = 0; v < nvoices; v++) {
+        sk_core_constant(core, voice(v, 0));
+        sk_core_constant(core, voice(v, 1));
+        sk_node_glottis(core);
+        sk_core_constant(core, voice(v, 2));
+        sk_core_constant(core, voice(v, 3));
+        sk_core_constant(core, voice(v, 4));
+        sk_node_tractxyv(core);
+        if (v > 0) sk_node_add(core);
+    }
+
+    return core;
+}
+
+static double run(int nvoices, int bank, SKFLT *out)
+{
+    sk_core *core;
+    sk_param p;
+    gf_cable *c;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    core = patch(nvoices, bank);
+    sk_param_get(core, &p);
+    c = sk_param_cable(&p);
+
+    end = (unsigned long)SR * SECS;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        start = clock();
+        sk_core_compute(core);
+        total += clock() - start;
+        for (n = 0; n < BLKSIZE && pos + n < end; n++) {
+            out[pos + n] = gf_cable_get(c, n);
+        }
+    }
+
+    sk_core_del(core);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+    int nvoices;
+
+    len = (unsigned long)SR * SECS;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("block size %d, %d seconds of audio\n", BLKSIZE, SECS);
+
+    for (nvoices = 4; nvoices <= 16; nvoices *= 2) {
+        ta = run(nvoices, 0, a);
+        tb = run(nvoices, 1, b);
+
+        diff = 0;
+        for (i = 0; i < len; i++) {
+            if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+        }
+
+        printf("%2d voices: glottis+tract %gs, ensemble %gs "
+               "(%.2fx faster), biggest difference %g\n",
+               nvoices, ta, tb, ta / tb, diff);
+    }
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * Measures what splitting blocks at events costs.
+ *
+ * A patch of sines gets rendered at a large block size,
+ * with an event every so many samples. Each event writes
+ * to a live value, so there is always something for it to
+ * do. The time taken is compared with rendering the same
+ * patch with no events at all.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 1024
+#define NSINES 100
+#define SECS 10
+
+static void set(sk_core *core, void *ud)
+{
+    sk_live *live;
+    live = ud;
+    /* every other event goes up, so the output changes */
+    sk_core_pqpush(core, live, 0, (sk_core_time(core) & 1) ? 0.6 : 0.5);
+}
+
+static sk_core *patch(sk_live **live)
+{
+    sk_core *core;
+    int s;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    for (s = 0; s < NSINES; s++) {
+        sk_core_constant(core, 110 * (1 + s * 0.01));
+        sk_core_constant(core, 0.5 / NSINES);
+        sk_node_sine(core);
+        if (s > 0) sk_node_add(core);
+    }
+
+    sk_core_live(core, 0.5, live);
+    sk_node_mul(core);
+
+    return core;
+}
+
+static double run(int every)
+{
+    sk_core *core;
+    sk_live *live;
+    unsigned long next, end;
+    clock_t start;
+
+    core = patch(&live);
+    end = (unsigned long)SR * SECS;
+    next = every;
+
+    start = clock();
+
+    while (sk_core_time(core) < end) {
+        /* keep the queue topped up for the next block */
+        while (every > 0 && next < sk_core_time(core) + BLKSIZE) {
+            if (sk_core_event(core, next, set, NULL, live)) break;
+            next += every;
+        }
+
+        sk_core_compute(core);
+    }
+
+    sk_core_del(core);
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    static const int every[] = {0, 4096, 1024, 333, 128, 64, 16, 4};
+    double base, t;
+    int i;
+
+    printf("%d sines, block size %d, %d seconds of audio\n",
+           NSINES, BLKSIZE, SECS);
+
+    base = run(0);
+    printf("no events:           %gs\n", base);
+
+    for (i = 1; i < (int)(sizeof(every) / sizeof(*every)); i++) {
+        t = run(every[i]);
+        printf("every %4d samples: %gs (%.2fx)\n", every[i], t, t / base);
+    }
+
+    return 0;
+}
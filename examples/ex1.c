@@ -10,7 +10,7 @@ int main(int argc, char *argv[])
     unsigned int n;
     unsigned int nblocks;
 
-    core = sk_core_new(44100);
+    core = sk_core_new(44100, 64);
 
     nblocks = sk_core_seconds_to_blocks(core, 10);
 
@@ -80,7 +80,7 @@ int main(int argc, char *argv[])
     size_t pos;
 
     lil = lil_new();
-    core = sk_core_new(44100);
+    core = sk_core_new(44100, 64);
     lil_set_data(lil, core);
 
     lil_register(lil, "sine", sine);
@@ -0,0 +1,210 @@
+/*
+ * Swaps between patches while rendering in real time.
+ *
+ * A builder thread keeps making new patches and handing
+ * them to the swapper, while the render thread computes
+ * blocks like an audio callback would. Reports the swap
+ * latency, the slowest block (in CPU time on the render
+ * thread), how many blocks went over budget, and the
+ * biggest jump between samples. This is compared with
+ * tearing down and rebuilding the core on the render thread.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define FADE 2048
+#define NSWAPS 20
+#define NSINES 200
+
+struct hotswap {
+    sk_swap *swap;
+    volatile int done;
+};
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* time spent by this thread, so the builder isn't counted */
+static double busy(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void nap(double secs)
+{
+    struct timespec t;
+    if (secs <= 0) return;
+    t.tv_sec = (time_t)secs;
+    t.tv_nsec = (long)((secs - t.tv_sec) * 1e9);
+    nanosleep(&t, NULL);
+}
+
+/* a quiet cluster of sines, expensive enough to build */
+static sk_core *patch(int n)
+{
+    sk_core *core;
+    int s;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    for (s = 0; s < NSINES; s++) {
+        sk_core_constant(core, 110 * (1 + (n % 4)) * (1 + s * 0.001));
+        sk_core_constant(core, 0.5 / NSINES);
+        sk_node_sine(core);
+        if (s > 0) sk_node_add(core);
+    }
+
+    return core;
+}
+
+static void *builder(void *ud)
+{
+    struct hotswap *h;
+    sk_core *core;
+    int n;
+
+    h = ud;
+
+    for (n = 0; n < NSWAPS; n++) {
+        core = patch(n);
+        while (sk_swap_submit(h->swap, core)) {
+            sk_swap_collect(h->swap);
+            nap(0.001);
+        }
+        nap(0.1);
+        sk_swap_collect(h->swap);
+    }
+
+    /* let the last one fade in, sk_swap_del gets the rest */
+    nap(2.0 * FADE / SR);
+
+    h->done = 1;
+    return NULL;
+}
+
+struct stats {
+    double worst;
+    int late;
+    double jump;
+    SKFLT prev;
+};
+
+static void tally(struct stats *st, double start, SKFLT *out)
+{
+    double elapsed;
+    int n;
+
+    elapsed = busy() - start;
+    if (elapsed > st->worst) st->worst = elapsed;
+    if (elapsed > (double)BLKSIZE / SR) st->late++;
+
+    for (n = 0; n < BLKSIZE; n++) {
+        if (fabs(out[n] - st->prev) > st->jump) {
+            st->jump = fabs(out[n] - st->prev);
+        }
+        st->prev = out[n];
+    }
+}
+
+static void swapped(void)
+{
+    struct hotswap h;
+    struct stats st;
+    pthread_t thread;
+    SKFLT out[BLKSIZE];
+    unsigned long blk;
+    unsigned long last, max;
+    double start, blkstart;
+
+    h.swap = sk_swap_new(BLKSIZE, FADE);
+    h.done = 0;
+    st.worst = st.jump = st.prev = 0;
+    st.late = 0;
+
+    pthread_create(&thread, NULL, builder, &h);
+
+    start = now();
+    blk = 0;
+
+    while (!h.done) {
+        nap(start + blk * BLKSIZE / (double)SR - now());
+        blkstart = busy();
+        sk_swap_compute(h.swap, out);
+        tally(&st, blkstart, out);
+        blk++;
+    }
+
+    pthread_join(thread, NULL);
+    sk_swap_latency(h.swap, &last, &max);
+
+    printf("swapper: latency %lu samples (max %lu), "
+           "slowest block %gus, %d late, biggest jump %g\n",
+           last, max, st.worst * 1e6, st.late, st.jump);
+
+    sk_swap_del(h.swap);
+}
+
+static void rebuilt(void)
+{
+    struct stats st;
+    sk_core *core;
+    gf_cable *c;
+    sk_param p;
+    SKFLT out[BLKSIZE];
+    double blkstart;
+    int swap;
+    int b;
+    int n;
+
+    st.worst = st.jump = st.prev = 0;
+    st.late = 0;
+    core = NULL;
+    c = NULL;
+
+    for (swap = 0; swap < NSWAPS; swap++) {
+        for (b = 0; b < 100; b++) {
+            blkstart = busy();
+
+            if (b == 0) {
+                sk_core_del(core);
+                core = patch(swap);
+                sk_param_get(core, &p);
+                c = sk_param_cable(&p);
+            }
+
+            sk_core_compute(core);
+            for (n = 0; n < BLKSIZE; n++) out[n] = gf_cable_get(c, n);
+            tally(&st, blkstart, out);
+        }
+    }
+
+    printf("rebuild: slowest block %gus, %d late, biggest jump %g\n",
+           st.worst * 1e6, st.late, st.jump);
+
+    sk_core_del(core);
+}
+
+int main(int argc, char *argv[])
+{
+    printf("%d swaps, block budget %gus\n",
+           NSWAPS, 1e6 * BLKSIZE / SR);
+    swapped();
+    rebuilt();
+    return 0;
+}
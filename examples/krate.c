@@ -0,0 +1,90 @@
+/*
+ * Compares audio-rate and control-rate modulation.
+ *
+ * Each voice is a sine with an envelope, and vibrato from
+ * an LFO going through scale, mtof, and a smoother. The
+ * same patch is built with the modulators running at audio
+ * rate, and again with their control-rate variants, and
+ * the time taken to render each one is compared. The
+ * oscillators making the sound stay at audio rate in both.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define NVOICES 64
+#define SECS 10
+
+static void voice(sk_core *core, int v, int k)
+{
+    /* gate */
+    sk_core_constant(core, 1 + v * 0.05);
+    sk_node_metro(core);
+    sk_core_constant(core, 0.3);
+    sk_node_tgate(core);
+
+    /* envelope */
+    sk_core_constant(core, 0.01);
+    sk_core_constant(core, 0.1);
+    sk_core_constant(core, 0.5);
+    sk_core_constant(core, 0.2);
+    if (k) sk_node_kadsr(core); else sk_node_adsr(core);
+    sk_core_constant(core, 0.5 / NVOICES);
+    sk_node_mul(core);
+
+    /* vibrato */
+    sk_core_constant(core, 5 + v * 0.01);
+    sk_core_constant(core, 1);
+    if (k) sk_node_ksine(core); else sk_node_sine(core);
+    sk_core_constant(core, 48 + v * 0.5);
+    sk_core_constant(core, 48.5 + v * 0.5);
+    if (k) sk_node_kbiscale(core); else sk_node_biscale(core);
+    if (k) sk_node_kmtof(core); else sk_node_mtof(core);
+    sk_core_constant(core, 0.01);
+    if (k) sk_node_ksmoother(core); else sk_node_smoother(core);
+
+    sk_core_swap(core);
+    sk_node_sine(core);
+}
+
+static double run(int k)
+{
+    sk_core *core;
+    unsigned long end;
+    clock_t start;
+    int v;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    for (v = 0; v < NVOICES; v++) {
+        voice(core, v, k);
+        if (v > 0) sk_node_add(core);
+    }
+
+    end = (unsigned long)SR * SECS;
+    start = clock();
+    while (sk_core_time(core) < end) sk_core_compute(core);
+
+    sk_core_del(core);
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    double a, k;
+
+    printf("%d voices, block size %d, %d seconds of audio\n",
+           NVOICES, BLKSIZE, SECS);
+
+    a = run(0);
+    printf("audio rate:   %gs\n", a);
+    k = run(1);
+    printf("control rate: %gs (%.2fx faster)\n", k, a / k);
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Compares a modal bank with separate modalres filters.
+ *
+ * The same set of modes gets built two ways: as a modalres
+ * node for every mode, scaled and added together, and as one
+ * modalbank node, with the frequencies, Qs, and gains in
+ * tables. The input is quiet noise. Reports the time taken
+ * by each, and the biggest difference between their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define NMODES 128
+#define SECS 10
+
+static SKFLT freq(int k)
+{
+    return 200 * (1 + k * 0.35) * (1 + 0.0005 * k);
+}
+
+static SKFLT q(int k)
+{
+    return 400.0 / (1 + 0.05 * k);
+}
+
+static SKFLT gain(int k)
+{
+    return 0.5 / (k + 1);
+}
+
+static void table(sk_core *core, SKFLT (*val)(int))
+{
+    sk_table *tab;
+    SKFLT *data;
+    int k;
+
+    sk_core_table_new(core, NMODES);
+    sk_core_table_pop(core, &tab);
+    data = sk_table_data(tab);
+    for (k = 0; k < NMODES; k++) data[k] = val(k);
+    sk_core_table_push(core, tab);
+}
+
+static void input(sk_core *core)
+{
+    sk_node_noise(core);
+    sk_core_constant(core, 0.01);
+    sk_node_mul(core);
+}
+
+static sk_core *patch(int bank)
+{
+    sk_core *core;
+    int k;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    if (bank) {
+        table(core, freq);
+        table(core, q);
+        table(core, gain);
+        input(core);
+        sk_node_modalbank(core);
+        return core;
+    }
+
+    input(core);
+    sk_core_hold(core);
+    sk_core_regset(core, 0);
+
+    for (k = 0; k < NMODES; k++) {
+        sk_core_regget(core, 0);
+        sk_core_constant(core, freq(k));
+        sk_core_constant(core, q(k));
+        sk_node_modalres(core);
+        sk_core_constant(core, gain(k));
+        sk_node_mul(core);
+        if (k > 0) sk_node_add(core);
+    }
+
+    sk_core_regget(core, 0);
+    sk_core_unhold(core);
+
+    return core;
+}
+
+static double run(int bank, SKFLT *out)
+{
+    sk_core *core;
+    sk_param p;
+    gf_cable *c;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    core = patch(bank);
+    sk_param_get(core, &p);
+    c = sk_param_cable(&p);
+
+    end = (unsigned long)SR * SECS;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        start = clock();
+        sk_core_compute(core);
+        total += clock() - start;
+        for (n = 0; n < BLKSIZE && pos + n < end; n++) {
+            out[pos + n] = gf_cable_get(c, n);
+        }
+    }
+
+    sk_core_del(core);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+
+    len = (unsigned long)SR * SECS;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("%d modes, block size %d, %d seconds of audio\n",
+           NMODES, BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("modalres:  %gs\n", ta);
+    tb = run(1, b);
+    printf("modalbank: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+    }
+    printf("biggest difference: %g\n", diff);
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Compares an oscillator bank with separate oscillators.
+ *
+ * An additive patch gets built two ways: as an osc node for
+ * every partial, added together, and as one oscbankt node,
+ * with the frequencies and amplitudes in tables. All the
+ * partials read the same sine table. Reports the time taken
+ * by each, and the biggest difference between their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define NVOICES 32
+#define SECS 10
+
+static SKFLT freq(int v)
+{
+    return 110 * (v + 1) * (1 + 0.001 * v);
+}
+
+static SKFLT amp(int v)
+{
+    return 0.5 / (v + 1);
+}
+
+static void table(sk_core *core, SKFLT (*val)(int))
+{
+    sk_table *tab;
+    SKFLT *data;
+    int v;
+
+    sk_core_table_new(core, NVOICES);
+    sk_core_table_pop(core, &tab);
+    data = sk_table_data(tab);
+    for (v = 0; v < NVOICES; v++) data[v] = val(v);
+    sk_core_table_push(core, tab);
+}
+
+static sk_core *patch(int bank)
+{
+    sk_core *core;
+    int v;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    sk_core_table_new(core, 8192);
+    sk_node_gensine(core);
+    sk_core_regset(core, 0);
+
+    if (bank) {
+        sk_core_regget(core, 0);
+        table(core, freq);
+        table(core, amp);
+        sk_node_oscbankt(core);
+        return core;
+    }
+
+    for (v = 0; v < NVOICES; v++) {
+        sk_core_regget(core, 0);
+        sk_core_constant(core, freq(v));
+        sk_core_constant(core, amp(v));
+        sk_core_constant(core, 0);
+        sk_node_osc(core);
+        if (v > 0) sk_node_add(core);
+    }
+
+    return core;
+}
+
+static double run(int bank, SKFLT *out)
+{
+    sk_core *core;
+    sk_param p;
+    gf_cable *c;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    core = patch(bank);
+    sk_param_get(core, &p);
+    c = sk_param_cable(&p);
+
+    end = (unsigned long)SR * SECS;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        start = clock();
+        sk_core_compute(core);
+        total += clock() - start;
+        for (n = 0; n < BLKSIZE && pos + n < end; n++) {
+            out[pos + n] = gf_cable_get(c, n);
+        }
+    }
+
+    sk_core_del(core);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+
+    len = (unsigned long)SR * SECS;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("%d voices, block size %d, %d seconds of audio\n",
+           NVOICES, BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("osc + add: %gs\n", ta);
+    tb = run(1, b);
+    printf("oscbank:   %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+    }
+    printf("biggest difference: %g\n", diff);
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Stress test for the parameter queue.
+ *
+ * A render thread computes blocks in real time, while a
+ * producer thread hammers a live value with writes. Writes
+ * with no timestamp measure the latency (in microseconds)
+ * from being pushed to being heard. Timestamped writes
+ * measure jitter: how many samples off from the requested
+ * time they land.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include "graforge.h"
+#include "core.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define NWRITES 4000
+#define AHEAD 512
+
+struct stress {
+    sk_core *core;
+    sk_live *live;
+    gf_cable *out;
+    int timed;
+    double pushed[NWRITES];
+    double heard[NWRITES];
+    unsigned long want[NWRITES];
+    unsigned long got[NWRITES];
+    int full;
+};
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void nap(double secs)
+{
+    struct timespec t;
+    if (secs <= 0) return;
+    t.tv_sec = (time_t)secs;
+    t.tv_nsec = (long)((secs - t.tv_sec) * 1e9);
+    nanosleep(&t, NULL);
+}
+
+static void *producer(void *ud)
+{
+    struct stress *s;
+    int i;
+    unsigned long time;
+
+    s = ud;
+
+    for (i = 1; i < NWRITES; i++) {
+        time = 0;
+        if (s->timed) {
+            time = sk_core_time(s->core) + AHEAD;
+            s->want[i] = time;
+        }
+
+        s->pushed[i] = now();
+
+        while (sk_core_pqpush(s->core, s->live, time, i)) {
+            s->full++;
+            nap(0.0001);
+        }
+
+        /* somewhere between a tenth and a full block */
+        nap((0.1 + 0.9 * (rand() / (double)RAND_MAX)) *
+            BLKSIZE / (double)SR);
+    }
+
+    return NULL;
+}
+
+static void render(struct stress *s)
+{
+    double start, blkstart;
+    unsigned long blk;
+    int last;
+    int n;
+    int v;
+
+    start = now();
+    last = 0;
+    blk = 0;
+
+    while (last < NWRITES - 1) {
+        /* wait for this block's turn, like an audio callback */
+        nap(start + blk * BLKSIZE / (double)SR - now());
+        blkstart = now();
+        sk_core_compute(s->core);
+
+        for (n = 0; n < BLKSIZE; n++) {
+            v = gf_cable_get(s->out, n);
+            if (v != last) {
+                s->heard[v] = blkstart;
+                s->got[v] = blk * BLKSIZE + n;
+                last = v;
+            }
+        }
+
+        blk++;
+    }
+}
+
+static void report(struct stress *s, const char *name)
+{
+    int i;
+    int count;
+    double sum, sum2, max, x;
+
+    count = 0;
+    sum = sum2 = max = 0;
+
+    /* merged writes are never heard on their own */
+    for (i = 1; i < NWRITES; i++) {
+        if (s->heard[i] == 0) continue;
+
+        if (s->timed) {
+            x = (double)s->got[i] - (double)s->want[i];
+        } else {
+            x = (s->heard[i] - s->pushed[i]) * 1e6;
+        }
+
+        if (fabs(x) > max) max = fabs(x);
+        sum += x;
+        sum2 += x * x;
+        count++;
+    }
+
+    sum /= count;
+    printf("%s: %d heard, mean %g, stddev %g, max %g (%s), "
+           "queue full %d times\n",
+           name, count, sum, sqrt(sum2 / count - sum * sum), max,
+           s->timed ? "samples" : "us", s->full);
+}
+
+static void run(int timed)
+{
+    struct stress *s;
+    sk_param p;
+    pthread_t thread;
+
+    s = calloc(1, sizeof(struct stress));
+    s->timed = timed;
+    s->core = sk_core_new(SR, BLKSIZE);
+
+    sk_core_live(s->core, 0, &s->live);
+    sk_param_get(s->core, &p);
+    s->out = sk_param_cable(&p);
+
+    pthread_create(&thread, NULL, producer, s);
+    render(s);
+    pthread_join(thread, NULL);
+
+    report(s, timed ? "timestamped" : "immediate");
+
+    sk_core_del(s->core);
+    free(s);
+}
+
+int main(int argc, char *argv[])
+{
+    run(0);
+    run(1);
+    return 0;
+}
@@ -65,7 +65,7 @@ int main(int argc, char *argv[])
     unsigned int nblocks;
     int rc;
 
-    core = sk_core_new(44100);
+    core = sk_core_new(44100, 64);
 
     rc = patch(core);
 
@@ -0,0 +1,135 @@
+/*
+ * Compares a parametric EQ made with an sosbank with one
+ * made out of separate filters.
+ *
+ * The same EQ gets built two ways: as a peakeq node for every
+ * band, one after the other, and as one eqstack node, with
+ * the bands in a table. The input is white noise. Reports
+ * the time taken by each, and the biggest difference between
+ * their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "graforge.h"
+#include "core.h"
+#include "sknodes.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define NBANDS 8
+#define SECS 10
+
+static SKFLT freq(int b)
+{
+    return 100 * pow(1.8, b);
+}
+
+static SKFLT bw(int b)
+{
+    return freq(b) * 0.5;
+}
+
+static SKFLT gain(int b)
+{
+    return (b % 2) ? -6 : 4.5;
+}
+
+static sk_core *patch(int bank)
+{
+    sk_core *core;
+    sk_table *tab;
+    SKFLT *data;
+    int b;
+
+    core = sk_core_new(SR, BLKSIZE);
+
+    if (bank) {
+        sk_core_table_new(core, 4 * NBANDS);
+        sk_core_table_pop(core, &tab);
+        data = sk_table_data(tab);
+        for (b = 0; b < NBANDS; b++) {
+            data[4*b] = 0;
+            data[4*b + 1] = freq(b);
+            data[4*b + 2] = bw(b);
+            data[4*b + 3] = gain(b);
+        }
+        sk_core_table_push(core, tab);
+        sk_node_noise(core);
+        sk_node_eqstack(core);
+        return core;
+    }
+
+    sk_node_noise(core);
+
+    for (b = 0; b < NBANDS; b++) {
+        sk_core_constant(core, freq(b));
+        sk_core_constant(core, bw(b));
+        sk_core_constant(core, pow(10.0, gain(b) / 20.0));
+        sk_node_peakeq(core);
+    }
+
+    return core;
+}
+
+static double run(int bank, SKFLT *out)
+{
+    sk_core *core;
+    sk_param p;
+    gf_cable *c;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    core = patch(bank);
+    sk_param_get(core, &p);
+    c = sk_param_cable(&p);
+
+    end = (unsigned long)SR * SECS;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        start = clock();
+        sk_core_compute(core);
+        total += clock() - start;
+        for (n = 0; n < BLKSIZE && pos + n < end; n++) {
+            out[pos + n] = gf_cable_get(c, n);
+        }
+    }
+
+    sk_core_del(core);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+
+    len = (unsigned long)SR * SECS;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("%d bands, block size %d, %d seconds of audio\n",
+           NBANDS, BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("peakeq:  %gs\n", ta);
+    tb = run(1, b);
+    printf("eqstack: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+    }
+    printf("biggest difference: %g\n", diff);
+
+    free(a);
+    free(b);
+    return 0;
+}
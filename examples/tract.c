@@ -0,0 +1,114 @@
+/*
+ * Compares the two ways of running tract.
+ *
+ * The same pulse train goes through one tract a sample at
+ * a time with sk_tract_tick, setting the tongue and velum
+ * every sample like an audio-rate patch would, and through
+ * another one a block at a time with sk_tract_compute,
+ * setting them once a block. The shape changes a few times a
+ * second, and holds in between. Reports the time taken by
+ * each, and the biggest difference between their outputs,
+ * which comes from the compute version ramping to each new
+ * shape over a block.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#define SK_TRACT_PRIV
+#include "dsp/tract.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define SECS 60
+
+/* whole blocks */
+#define NBLKS ((SR * SECS + BLKSIZE - 1) / BLKSIZE)
+
+/* a new shape every 1/4 second, lined up with the blocks */
+#define HOLD (SR / 4 / BLKSIZE * BLKSIZE)
+
+static void shape(unsigned long pos, SKFLT *x, SKFLT *y, SKFLT *v)
+{
+    unsigned long s;
+
+    s = pos / HOLD;
+    *x = (SKFLT)((s * 7) % 10) / 10;
+    *y = 0.3 + (SKFLT)((s * 3) % 7) / 10;
+    *v = (s % 4) == 0 ? 0.8 : 0.01;
+}
+
+static double run(int block, SKFLT *out)
+{
+    sk_tract *tr;
+    SKFLT in[BLKSIZE];
+    SKFLT x, y, v;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    tr = malloc(sizeof(sk_tract));
+    sk_tract_init(tr);
+    sk_tract_use_velum(tr, 1);
+
+    end = (unsigned long)NBLKS * BLKSIZE;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        for (n = 0; n < BLKSIZE; n++) {
+            in[n] = ((pos + n) % 400) < 20 ? 1 : 0;
+        }
+
+        shape(pos, &x, &y, &v);
+
+        start = clock();
+
+        if (block) {
+            sk_tract_tongue_shape(tr, x, y);
+            sk_tract_velum(tr, v);
+            sk_tract_compute(tr, BLKSIZE, in, &out[pos]);
+        } else {
+            for (n = 0; n < BLKSIZE; n++) {
+                sk_tract_tongue_shape(tr, x, y);
+                sk_tract_velum(tr, v);
+                out[pos + n] = sk_tract_tick(tr, in[n]);
+            }
+        }
+
+        total += clock() - start;
+    }
+
+    free(tr);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff;
+
+    len = (unsigned long)NBLKS * BLKSIZE;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("block size %d, %d seconds of audio\n", BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("tick:    %gs\n", ta);
+    tb = run(1, b);
+    printf("compute: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+    }
+    printf("biggest difference: %g\n", diff);
+
+    free(a);
+    free(b);
+    return 0;
+}
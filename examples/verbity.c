@@ -0,0 +1,113 @@
+/*
+ * Compares the two ways of running verbity.
+ *
+ * The same noise bursts go through one reverb a sample at a
+ * time with sk_verbity_tick, setting the parameters every
+ * sample like an audio-rate patch would, and through another
+ * one a block at a time with sk_verbity_compute, setting
+ * them once a block. The parameters stay put, so the outputs
+ * should be the same. Reports the time taken by each, and
+ * the biggest difference between their outputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "extra/verbity/verbity.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define SECS 60
+
+/* whole blocks */
+#define NBLKS ((SR * SECS + BLKSIZE - 1) / BLKSIZE)
+
+static double run(int block, SKFLT *outL, SKFLT *outR)
+{
+    sk_verbity *v;
+    SKFLT inL[BLKSIZE], inR[BLKSIZE];
+    unsigned long pos, end;
+    unsigned long rng;
+    clock_t start;
+    double total;
+    int n;
+
+    v = sk_verbity_new(SR);
+
+    end = (unsigned long)NBLKS * BLKSIZE;
+    total = 0;
+    rng = 1;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        for (n = 0; n < BLKSIZE; n++) {
+            SKFLT x;
+            rng = (rng * 1103515245UL + 12345UL) & 0x7fffffffUL;
+            x = ((pos + n) % SR) < 2000 ? 0.3 * ((SKFLT)rng / 0x7fffffff - 0.5) : 0;
+            inL[n] = x;
+            inR[n] = 0.5 * x;
+        }
+
+        start = clock();
+
+        if (block) {
+            sk_verbity_bigness(v, 0.9);
+            sk_verbity_longness(v, 0.9);
+            sk_verbity_darkness(v, 0.5);
+            sk_verbity_compute(v, BLKSIZE, inL, inR,
+                               &outL[pos], &outR[pos]);
+        } else {
+            for (n = 0; n < BLKSIZE; n++) {
+                sk_verbity_bigness(v, 0.9);
+                sk_verbity_longness(v, 0.9);
+                sk_verbity_darkness(v, 0.5);
+                sk_verbity_tick(v, &inL[n], &inR[n],
+                                &outL[pos + n], &outR[pos + n]);
+            }
+        }
+
+        total += clock() - start;
+    }
+
+    sk_verbity_del(v);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a[2], *b[2];
+    unsigned long i, len;
+    double ta, tb;
+    double diff, peak;
+    int c;
+
+    len = (unsigned long)NBLKS * BLKSIZE;
+
+    for (c = 0; c < 2; c++) {
+        a[c] = malloc(sizeof(SKFLT) * len);
+        b[c] = malloc(sizeof(SKFLT) * len);
+    }
+
+    printf("block size %d, %d seconds of audio\n", BLKSIZE, SECS);
+
+    ta = run(0, a[0], a[1]);
+    printf("tick:    %gs\n", ta);
+    tb = run(1, b[0], b[1]);
+    printf("compute: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    peak = 0;
+    for (c = 0; c < 2; c++) {
+        for (i = 0; i < len; i++) {
+            if (fabs(a[c][i] - b[c][i]) > diff) diff = fabs(a[c][i] - b[c][i]);
+            if (fabs(a[c][i]) > peak) peak = fabs(a[c][i]);
+        }
+    }
+    printf("biggest difference: %g (peak %g)\n", diff, peak);
+
+    for (c = 0; c < 2; c++) {
+        free(a[c]);
+        free(b[c]);
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * Compares the two ways of running vowel.
+ *
+ * The same pulse train goes through one vowel filter a
+ * sample at a time with sk_vowel_tick, morphing the phoneme
+ * every sample like an audio-rate patch would, and through
+ * another one a block at a time with sk_vowel_compute,
+ * morphing it once a block. The phoneme keeps moving the
+ * whole time. Reports the time taken by each, and the
+ * biggest difference between their outputs, which comes from
+ * the compute version only morphing once a block.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#define SK_VOWEL_PRIV
+#include "dsp/vowel.h"
+
+#define SR 44100
+#define BLKSIZE 64
+#define SECS 60
+
+/* whole blocks */
+#define NBLKS ((SR * SECS + BLKSIZE - 1) / BLKSIZE)
+
+/* where the morph is at the start of a block */
+static void morph(unsigned long pos, SKFLT *v, SKFLT *p)
+{
+    SKFLT t;
+
+    t = (SKFLT)pos / SR;
+    *v = 0.5 + 0.5 * sin(2 * M_PI * 0.5 * t);
+    *p = 0.5 + 0.4 * sin(2 * M_PI * 0.1 * t);
+}
+
+static double run(int block, SKFLT *out)
+{
+    sk_vowel *vow;
+    sk_vowel_formant ph[5], tmp[5];
+    SKFLT in[BLKSIZE];
+    SKFLT v, p;
+    unsigned long pos, end;
+    clock_t start;
+    double total;
+    int n;
+
+    vow = malloc(sizeof(sk_vowel));
+    sk_vowel_init(vow, SR);
+
+    end = (unsigned long)NBLKS * BLKSIZE;
+    total = 0;
+
+    for (pos = 0; pos < end; pos += BLKSIZE) {
+        for (n = 0; n < BLKSIZE; n++) {
+            in[n] = ((pos + n) % 400) < 20 ? 1 : 0;
+        }
+
+        start = clock();
+
+        if (block) {
+            morph(pos, &v, &p);
+            sk_vowel_morph(ph, tmp, 5, v, p);
+            sk_vowel_set_phoneme(vow, ph, 5);
+            sk_vowel_compute(vow, BLKSIZE, in, &out[pos]);
+        } else {
+            for (n = 0; n < BLKSIZE; n++) {
+                morph(pos + n, &v, &p);
+                sk_vowel_morph(ph, tmp, 5, v, p);
+                sk_vowel_set_phoneme(vow, ph, 5);
+                out[pos + n] = sk_vowel_tick(vow, in[n]);
+            }
+        }
+
+        total += clock() - start;
+    }
+
+    free(vow);
+    return total / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    SKFLT *a, *b;
+    unsigned long i, len;
+    double ta, tb;
+    double diff, peak;
+
+    len = (unsigned long)NBLKS * BLKSIZE;
+    a = malloc(sizeof(SKFLT) * len);
+    b = malloc(sizeof(SKFLT) * len);
+
+    printf("block size %d, %d seconds of audio\n", BLKSIZE, SECS);
+
+    ta = run(0, a);
+    printf("tick:    %gs\n", ta);
+    tb = run(1, b);
+    printf("compute: %gs (%.2fx faster)\n", tb, ta / tb);
+
+    diff = 0;
+    peak = 0;
+    for (i = 0; i < len; i++) {
+        if (fabs(a[i] - b[i]) > diff) diff = fabs(a[i] - b[i]);
+        if (fabs(a[i]) > peak) peak = fabs(a[i]);
+    }
+    printf("biggest difference: %g (peak %g)\n", diff, peak);
+
+    free(a);
+    free(b);
+    return 0;
+}
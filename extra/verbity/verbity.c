@@ -17,6 +17,19 @@
  * (same license as Soundpipe), Copyright 2021 Chris
  * Johnson.
  *
+ * The 12 delay lines live in one allocation, lined up to
+ * cache lines, with each one only as long as the largest
+ * bigness needs. Left and right share the same delay times,
+ * so each line stores stereo frames, left and right side by
+ * side, and both get read and written together. The 4 lines
+ * of each stage and both channels are kept in small arrays,
+ * so the mixing between lines is the same work done 8 times
+ * over, which compilers can turn into vector instructions.
+ *
+ * sk_verbity_compute does a whole block, working out the
+ * parameters once at the start of it. sk_verbity_tick does
+ * one sample.
+ *
  * If you like this plugin, please please please consider
  * supporting Chris and AirWindows via Patreon:
  * https://www.patreon.com/airwindows
@@ -33,9 +46,33 @@
 #define SK_VERBITY_PRIV
 #include "verbity.h"
 
-void sk_verbity_init(sk_verbity *v, int sr)
+/* delay times at a size of 1 */
+static const double base_delay[SK_VERBITY_NLINES] = {
+    3407.0, 1823.0, 859.0, 331.0,
+    4801.0, 2909.0, 1153.0, 461.0,
+    7607.0, 4217.0, 2269.0, 1597.0
+};
+
+/* parameters that stay the same for a block */
+struct verbity_params {
+    int cycleEnd;
+    SKFLT regen;
+    SKFLT lowpass;
+    SKFLT interpolate;
+    SKFLT thunderAmount;
+};
+
+sk_verbity * sk_verbity_new(int sr)
 {
-    int count;
+    sk_verbity *v;
+    SKFLT maxsize;
+    unsigned long total;
+    unsigned long pos;
+    SKFLT *buf;
+    int i;
+
+    v = calloc(1, sizeof(sk_verbity));
+    if (v == NULL) return NULL;
 
     v->sr = sr;
 
@@ -43,418 +80,276 @@ void sk_verbity_init(sk_verbity *v, int sr)
     v->longness = 0.0;
     v->darkness = 0.25;
 
-    v->iirAL = 0.0;
-    v->iirAR = 0.0;
-
-    v->iirBL = 0.0;
-    v->iirBR = 0.0;
+    /* the longest each line can get, with a bigness of 1 */
+    maxsize = (1.0*1.77)+0.1;
 
-    for (count = 0; count < 6479; count++) {
-        v->aIL[count] = 0.0;
-        v->aIR[count] = 0.0;
+    /* 2 samples a frame, rounded up to whole cache lines */
+    total = 0;
+    for (i = 0; i < SK_VERBITY_NLINES; i++) {
+        v->maxdelay[i] = base_delay[i]*maxsize;
+        total += (2*(v->maxdelay[i] + 1) + 15) & ~15UL;
     }
 
-    for (count = 0; count < 3659; count++) {
-        v->aJL[count] = 0.0;
-        v->aJR[count] = 0.0;
-    }
-
-    for (count = 0; count < 1719; count++) {
-        v->aKL[count] = 0.0;
-        v->aKR[count] = 0.0;
-    }
-
-    for (count = 0; count < 679; count++) {
-        v->aLL[count] = 0.0;
-        v->aLR[count] = 0.0;
-    }
-
-    for (count = 0; count < 9699; count++) {
-        v->aAL[count] = 0.0;
-        v->aAR[count] = 0.0;
-    }
-
-    for (count = 0; count < 5999; count++) {
-        v->aBL[count] = 0.0;
-        v->aBR[count] = 0.0;
-    }
+    v->mem = calloc(1, sizeof(SKFLT)*total + 64);
 
-    for (count = 0; count < 2319; count++) {
-        v->aCL[count] = 0.0;
-        v->aCR[count] = 0.0;
+    if (v->mem == NULL) {
+        free(v);
+        return NULL;
     }
 
-    for (count = 0; count < 939; count++) {
-        v->aDL[count] = 0.0;
-        v->aDR[count] = 0.0;
-    }
-
-    for (count = 0; count < 15219; count++) {
-        v->aEL[count] = 0.0;
-        v->aER[count] = 0.0;
-    }
+    buf = (SKFLT *)(((size_t)v->mem + 63) & ~(size_t)63);
 
-    for (count = 0; count < 8459; count++) {
-        v->aFL[count] = 0.0;
-        v->aFR[count] = 0.0;
+    pos = 0;
+    for (i = 0; i < SK_VERBITY_NLINES; i++) {
+        v->line[i] = &buf[pos];
+        v->count[i] = 1;
+        pos += (2*(v->maxdelay[i] + 1) + 15) & ~15UL;
     }
 
-    for (count = 0; count < 4539; count++) {
-        v->aGL[count] = 0.0;
-        v->aGR[count] = 0.0;
-    }
-
-    for (count = 0; count < 3199; count++) {
-        v->aHL[count] = 0.0;
-        v->aHR[count] = 0.0;
-    }
-
-    v->feedbackAL = 0.0; v->feedbackAR = 0.0;
-    v->feedbackBL = 0.0; v->feedbackBR = 0.0;
-    v->feedbackCL = 0.0; v->feedbackCR = 0.0;
-    v->feedbackDL = 0.0; v->feedbackDR = 0.0;
-    v->previousAL = 0.0; v->previousAR = 0.0;
-    v->previousBL = 0.0; v->previousBR = 0.0;
-    v->previousCL = 0.0; v->previousCR = 0.0;
-    v->previousDL = 0.0; v->previousDR = 0.0;
-
-    for (count = 0; count < 6; count++) {
-        v->lastRefL[count] = 0.0;
-        v->lastRefR[count] = 0.0;
-    }
-
-    v->thunderL = 0;
-    v->thunderR = 0;
-
-    v->countI = 1;
-    v->countJ = 1;
-    v->countK = 1;
-    v->countL = 1;
-
-    v->countA = 1;
-    v->countB = 1;
-    v->countC = 1;
-    v->countD = 1;
-
-    v->countE = 1;
-    v->countF = 1;
-    v->countG = 1;
-    v->countH = 1;
     v->cycle = 0;
 
     v->psize = -1;
     v->onedsr = 1.0 / sr;
+
+    return v;
 }
 
-void sk_verbity_compute(sk_verbity *v,
-                        SKFLT *inL, SKFLT *inR,
-                        SKFLT *outL, SKFLT *outR)
+void sk_verbity_del(sk_verbity *v)
+{
+    free(v->mem);
+    free(v);
+}
+
+static void params(sk_verbity *v, struct verbity_params *p)
 {
     SKFLT overallscale;
-    int cycleEnd;
     SKFLT size;
-    SKFLT regen;
-    SKFLT lowpass;
-    SKFLT interpolate;
-    SKFLT thunderAmount;
-    SKFLT inputSampleL;
-    SKFLT inputSampleR;
+    int i;
 
     overallscale = 1.0;
     overallscale *= v->onedsr;
     overallscale *= v->sr;
 
-    cycleEnd = floor(overallscale);
-    if (cycleEnd < 1) cycleEnd = 1;
-    if (cycleEnd > 4) cycleEnd = 4;
+    p->cycleEnd = floor(overallscale);
+    if (p->cycleEnd < 1) p->cycleEnd = 1;
+    if (p->cycleEnd > 4) p->cycleEnd = 4;
 
     /* this is going to be 2 for 88.1 or 96k,
      * 3 for silly people, 4 for 176 or 192k
      */
 
     /* sanity check */
-    if (v->cycle > cycleEnd-1) v->cycle = cycleEnd-1;
+    if (v->cycle > p->cycleEnd-1) v->cycle = p->cycleEnd-1;
 
     size = (v->bigness*1.77)+0.1;
-    regen = 0.0625+(v->longness*0.03125); /* 0.09375 max; */
-    lowpass = (1.0-pow(v->darkness,2.0))/sqrt(overallscale);
-    interpolate = pow(v->darkness,2.0)*0.618033988749894848204586; /* has IIRlike qualities */
-    thunderAmount = (0.3-(v->longness*0.22))*v->darkness*0.1;
+    p->regen = 0.0625+(v->longness*0.03125); /* 0.09375 max; */
+    p->lowpass = (1.0-pow(v->darkness,2.0))/sqrt(overallscale);
+    p->interpolate = pow(v->darkness,2.0)*0.618033988749894848204586; /* has IIRlike qualities */
+    p->thunderAmount = (0.3-(v->longness*0.22))*v->darkness*0.1;
 
     if (size != v->psize) {
         v->psize = size;
-        v->delayI = 3407.0*size;
-        v->delayJ = 1823.0*size;
-        v->delayK = 859.0*size;
-        v->delayL = 331.0*size;
-
-        v->delayA = 4801.0*size;
-        v->delayB = 2909.0*size;
-        v->delayC = 1153.0*size;
-        v->delayD = 461.0*size;
-
-        v->delayE = 7607.0*size;
-        v->delayF = 4217.0*size;
-        v->delayG = 2269.0*size;
-        v->delayH = 1597.0*size;
+        for (i = 0; i < SK_VERBITY_NLINES; i++) {
+            v->delay[i] = base_delay[i]*size;
+            /* the lines only have room for a bigness of 1 */
+            if (v->delay[i] > v->maxdelay[i]) v->delay[i] = v->maxdelay[i];
+        }
     }
+}
+
+/*
+ * Writes the frames in w to the 4 lines of stage s, and
+ * reads what comes out of them into o.
+ */
 
-    inputSampleL = *inL;
-    inputSampleR = *inR;
+static void stage(sk_verbity *v, int s, SKFLT w[4][2], SKFLT o[4][2])
+{
+    int k;
 
-    if (fabs(v->iirAL)<1.18e-37) v->iirAL = 0.0;
-    v->iirAL =
-        (v->iirAL*(1.0-lowpass)) +
-        (inputSampleL*lowpass);
-    inputSampleL = v->iirAL;
+    for (k = 0; k < 4; k++) {
+        SKFLT *line;
+        int i, c;
 
-    if (fabs(v->iirAR)<1.18e-37) v->iirAR = 0.0;
-    v->iirAR =
-        (v->iirAR*(1.0-lowpass))+
-        (inputSampleR*lowpass);
-    inputSampleR = v->iirAR;
+        i = 4*s + k;
+        line = v->line[i];
+        c = v->count[i];
 
-    /* initial filter */
+        line[2*c] = w[k][0];
+        line[2*c + 1] = w[k][1];
 
-    v->cycle++;
-    if (v->cycle == cycleEnd) {
-        /* hit the end point and we do a reverb sample */
-        SKFLT ainterp = 1.0 - interpolate;
-        v->feedbackAL = (v->feedbackAL*(ainterp))+
-            (v->previousAL*interpolate);
-        v->previousAL = v->feedbackAL;
-        v->feedbackBL = (v->feedbackBL*(ainterp))+
-            (v->previousBL*interpolate);
-        v->previousBL = v->feedbackBL;
-        v->feedbackCL = (v->feedbackCL*(ainterp))+
-            (v->previousCL*interpolate);
-        v->previousCL = v->feedbackCL;
-        v->feedbackDL = (v->feedbackDL*(ainterp))+
-            (v->previousDL*interpolate);
-        v->previousDL = v->feedbackDL;
-        v->feedbackAR = (v->feedbackAR*(ainterp))+
-            (v->previousAR*interpolate);
-        v->previousAR = v->feedbackAR;
-
-        v->feedbackBR = (v->feedbackBR*(ainterp))+
-            (v->previousBR*interpolate);
-        v->previousBR = v->feedbackBR;
-        v->feedbackCR = (v->feedbackCR*(ainterp))+
-            (v->previousCR*interpolate);
-        v->previousCR = v->feedbackCR;
-        v->feedbackDR = (v->feedbackDR*(ainterp))+
-            (v->previousDR*interpolate);
-        v->previousDR = v->feedbackDR;
-
-        v->thunderL =
-            (v->thunderL*0.99)-(v->feedbackAL*thunderAmount);
-        v->thunderR =
-            (v->thunderR*0.99)-(v->feedbackAR*thunderAmount);
-
-        v->aIL[v->countI] = inputSampleL +
-            ((v->feedbackAL+v->thunderL) * regen);
-        v->aJL[v->countJ] = inputSampleL +
-            (v->feedbackBL * regen);
-        v->aKL[v->countK] = inputSampleL +
-            (v->feedbackCL * regen);
-        v->aLL[v->countL] = inputSampleL +
-            (v->feedbackDL * regen);
-        v->aIR[v->countI] = inputSampleR +
-            ((v->feedbackAR+v->thunderR) * regen);
-
-        v->aJR[v->countJ] = inputSampleR +
-            (v->feedbackBR * regen);
-        v->aKR[v->countK] = inputSampleR +
-            (v->feedbackCR * regen);
-        v->aLR[v->countL] = inputSampleR +
-            (v->feedbackDR * regen);
-
-        v->countI++;
-        if (v->countI < 0 || v->countI > v->delayI) v->countI = 0;
-
-        v->countJ++;
-        if (v->countJ < 0 || v->countJ > v->delayJ) v->countJ = 0;
-
-        v->countK++;
-        if (v->countK < 0 || v->countK > v->delayK) v->countK = 0;
-
-        v->countL++;
-        if (v->countL < 0 || v->countL > v->delayL) v->countL = 0;
-
-        {
-            SKFLT outIL = v->aIL[v->countI-((v->countI > v->delayI)?v->delayI+1:0)];
-            SKFLT outJL = v->aJL[v->countJ-((v->countJ > v->delayJ)?v->delayJ+1:0)];
-            SKFLT outKL = v->aKL[v->countK-((v->countK > v->delayK)?v->delayK+1:0)];
-            SKFLT outLL = v->aLL[v->countL-((v->countL > v->delayL)?v->delayL+1:0)];
-            SKFLT outIR = v->aIR[v->countI-((v->countI > v->delayI)?v->delayI+1:0)];
-            SKFLT outJR = v->aJR[v->countJ-((v->countJ > v->delayJ)?v->delayJ+1:0)];
-            SKFLT outKR = v->aKR[v->countK-((v->countK > v->delayK)?v->delayK+1:0)];
-            SKFLT outLR = v->aLR[v->countL-((v->countL > v->delayL)?v->delayL+1:0)];
-            /* first block: now we have four outputs */
-
-            v->aAL[v->countA] = (outIL - (outJL + outKL + outLL));
-            v->aBL[v->countB] = (outJL - (outIL + outKL + outLL));
-            v->aCL[v->countC] = (outKL - (outIL + outJL + outLL));
-            v->aDL[v->countD] = (outLL - (outIL + outJL + outKL));
-            v->aAR[v->countA] = (outIR - (outJR + outKR + outLR));
-            v->aBR[v->countB] = (outJR - (outIR + outKR + outLR));
-            v->aCR[v->countC] = (outKR - (outIR + outJR + outLR));
-            v->aDR[v->countD] = (outLR - (outIR + outJR + outKR));
-        }
+        c++;
+        if (c < 0 || c > v->delay[i]) c = 0;
+        v->count[i] = c;
 
-        v->countA++;
-        if (v->countA < 0 || v->countA > v->delayA) v->countA = 0;
-        v->countB++;
-        if (v->countB < 0 || v->countB > v->delayB) v->countB = 0;
-        v->countC++;
-        if (v->countC < 0 || v->countC > v->delayC) v->countC = 0;
-        v->countD++;
-        if (v->countD < 0 || v->countD > v->delayD) v->countD = 0;
-
-        {
-            SKFLT outAL = v->aAL[v->countA-((v->countA > v->delayA)?v->delayA+1:0)];
-            SKFLT outBL = v->aBL[v->countB-((v->countB > v->delayB)?v->delayB+1:0)];
-            SKFLT outCL = v->aCL[v->countC-((v->countC > v->delayC)?v->delayC+1:0)];
-            SKFLT outDL = v->aDL[v->countD-((v->countD > v->delayD)?v->delayD+1:0)];
-            SKFLT outAR = v->aAR[v->countA-((v->countA > v->delayA)?v->delayA+1:0)];
-            SKFLT outBR = v->aBR[v->countB-((v->countB > v->delayB)?v->delayB+1:0)];
-            SKFLT outCR = v->aCR[v->countC-((v->countC > v->delayC)?v->delayC+1:0)];
-            SKFLT outDR = v->aDR[v->countD-((v->countD > v->delayD)?v->delayD+1:0)];
-
-            /* second block: four more outputs */
-
-            v->aEL[v->countE] = (outAL - (outBL + outCL + outDL));
-            v->aFL[v->countF] = (outBL - (outAL + outCL + outDL));
-            v->aGL[v->countG] = (outCL - (outAL + outBL + outDL));
-            v->aHL[v->countH] = (outDL - (outAL + outBL + outCL));
-            v->aER[v->countE] = (outAR - (outBR + outCR + outDR));
-            v->aFR[v->countF] = (outBR - (outAR + outCR + outDR));
-            v->aGR[v->countG] = (outCR - (outAR + outBR + outDR));
-            v->aHR[v->countH] = (outDR - (outAR + outBR + outCR));
-        }
+        o[k][0] = line[2*c];
+        o[k][1] = line[2*c + 1];
+    }
+}
 
-        v->countE++;
-        if (v->countE < 0 || v->countE > v->delayE) v->countE = 0;
-
-        v->countF++;
-        if (v->countF < 0 || v->countF > v->delayF) v->countF = 0;
-
-        v->countG++;
-        if (v->countG < 0 || v->countG > v->delayG) v->countG = 0;
-
-        v->countH++;
-        if (v->countH < 0 || v->countH > v->delayH) v->countH = 0;
-
-        {
-            SKFLT outEL = v->aEL[v->countE-((v->countE > v->delayE)?v->delayE+1:0)];
-            SKFLT outFL = v->aFL[v->countF-((v->countF > v->delayF)?v->delayF+1:0)];
-            SKFLT outGL = v->aGL[v->countG-((v->countG > v->delayG)?v->delayG+1:0)];
-            SKFLT outHL = v->aHL[v->countH-((v->countH > v->delayH)?v->delayH+1:0)];
-            SKFLT outER = v->aER[v->countE-((v->countE > v->delayE)?v->delayE+1:0)];
-            SKFLT outFR = v->aFR[v->countF-((v->countF > v->delayF)?v->delayF+1:0)];
-            SKFLT outGR = v->aGR[v->countG-((v->countG > v->delayG)?v->delayG+1:0)];
-            SKFLT outHR = v->aHR[v->countH-((v->countH > v->delayH)?v->delayH+1:0)];
-            /* third block: final outputs */
-
-            v->feedbackAL = (outEL - (outFL + outGL + outHL));
-            v->feedbackBL = (outFL - (outEL + outGL + outHL));
-            v->feedbackCL = (outGL - (outEL + outFL + outHL));
-            v->feedbackDL = (outHL - (outEL + outFL + outGL));
-            v->feedbackAR = (outER - (outFR + outGR + outHR));
-            v->feedbackBR = (outFR - (outER + outGR + outHR));
-            v->feedbackCR = (outGR - (outER + outFR + outHR));
-            v->feedbackDR = (outHR - (outER + outFR + outGR));
-
-            /* which we need to feed back into the input again, a bit */
-
-            inputSampleL = (outEL + outFL + outGL + outHL) * 0.125;
-            inputSampleR = (outER + outFR + outGR + outHR) * 0.125;
-        }
+/* each line minus the other three */
 
-        /* and take the final combined sum of outputs */
-        if (cycleEnd == 4) {
-            /* start from previous last */
-            v->lastRefL[0] = v->lastRefL[4];
+static void mix(SKFLT o[4][2], SKFLT m[4][2])
+{
+    int c;
 
-            /* half */
-            v->lastRefL[2] = (v->lastRefL[0] + inputSampleL) * 0.5;
+    for (c = 0; c < 2; c++) {
+        m[0][c] = (o[0][c] - (o[1][c] + o[2][c] + o[3][c]));
+        m[1][c] = (o[1][c] - (o[0][c] + o[2][c] + o[3][c]));
+        m[2][c] = (o[2][c] - (o[0][c] + o[1][c] + o[3][c]));
+        m[3][c] = (o[3][c] - (o[0][c] + o[1][c] + o[2][c]));
+    }
+}
 
-            /* one quarter */
-            v->lastRefL[1] = (v->lastRefL[0] + v->lastRefL[2]) * 0.5;
+static void reverb(sk_verbity *v,
+                   struct verbity_params *p,
+                   SKFLT inL, SKFLT inR,
+                   SKFLT *outL, SKFLT *outR)
+{
+    SKFLT inputSample[2];
+    SKFLT lowpass;
+    int c, k;
+
+    lowpass = p->lowpass;
 
-            /* three quarters */
-            v->lastRefL[3] = (v->lastRefL[2] + inputSampleL) * 0.5;
+    inputSample[0] = inL;
+    inputSample[1] = inR;
 
-            /* full */
-            v->lastRefL[4] = inputSampleL;
+    for (c = 0; c < 2; c++) {
+        if (fabs(v->iirA[c])<1.18e-37) v->iirA[c] = 0.0;
+        v->iirA[c] =
+            (v->iirA[c]*(1.0-lowpass)) +
+            (inputSample[c]*lowpass);
+        inputSample[c] = v->iirA[c];
+    }
 
-            /* start from previous last */
-            v->lastRefR[0] = v->lastRefR[4];
+    /* initial filter */
 
-            /* half */
-            v->lastRefR[2] = (v->lastRefR[0] + inputSampleR) * 0.5;
+    v->cycle++;
+    if (v->cycle == p->cycleEnd) {
+        /* hit the end point and we do a reverb sample */
+        SKFLT ainterp = 1.0 - p->interpolate;
+        SKFLT w[4][2], o[4][2];
+
+        for (k = 0; k < 4; k++) {
+            for (c = 0; c < 2; c++) {
+                v->feedback[k][c] = (v->feedback[k][c]*(ainterp))+
+                    (v->previous[k][c]*p->interpolate);
+                v->previous[k][c] = v->feedback[k][c];
+            }
+        }
 
-            /* one quarter */
-            v->lastRefR[1] = (v->lastRefR[0] + v->lastRefR[2]) * 0.5;
-            /* three quarters */
-            v->lastRefR[3] = (v->lastRefR[2] + inputSampleR) * 0.5;
-            /* full */
-            v->lastRefR[4] = inputSampleR;
+        for (c = 0; c < 2; c++) {
+            v->thunder[c] =
+                (v->thunder[c]*0.99)-(v->feedback[0][c]*p->thunderAmount);
         }
-        if (cycleEnd == 3) {
-            /* start from previous last */
-            v->lastRefL[0] = v->lastRefL[3];
-            /* third */
-            v->lastRefL[2] = (v->lastRefL[0]+v->lastRefL[0]+inputSampleL) * 0.33333;
-            /* two thirds */
-            v->lastRefL[1] = (v->lastRefL[0]+inputSampleL+inputSampleL) * 0.33333;
-            /* full */
-            v->lastRefL[3] = inputSampleL;
-            /* start from previous last */
-            v->lastRefR[0] = v->lastRefR[3];
-
-            /* third */
-            v->lastRefR[2] = (v->lastRefR[0]+v->lastRefR[0]+inputSampleR) * 0.33333;
-            /* two thirds */
-            v->lastRefR[1] = (v->lastRefR[0]+inputSampleR+inputSampleR) * 0.33333;
-
-            /* full */
-            v->lastRefR[3] = inputSampleR;
+
+        for (c = 0; c < 2; c++) {
+            w[0][c] = inputSample[c] +
+                ((v->feedback[0][c]+v->thunder[c]) * p->regen);
+            for (k = 1; k < 4; k++) {
+                w[k][c] = inputSample[c] + (v->feedback[k][c] * p->regen);
+            }
         }
 
-        if (cycleEnd == 2) {
-            /* start from previous last */
-            v->lastRefL[0] = v->lastRefL[2];
-            /* half */
-            v->lastRefL[1] = (v->lastRefL[0] + inputSampleL) * 0.5;
-            /* full */
-            v->lastRefL[2] = inputSampleL;
+        /* first block: now we have four outputs */
+        stage(v, 0, w, o);
+        mix(o, w);
 
-            /* start from previous last */
-            v->lastRefR[0] = v->lastRefR[2];
+        /* second block: four more outputs */
+        stage(v, 1, w, o);
+        mix(o, w);
 
-            /* half */
-            v->lastRefR[1] = (v->lastRefR[0] + inputSampleR) * 0.5;
+        /* third block: final outputs */
+        stage(v, 2, w, o);
+        mix(o, v->feedback);
 
-            /* full */
-            v->lastRefR[2] = inputSampleR;
+        /* which we need to feed back into the input again, a bit */
+        for (c = 0; c < 2; c++) {
+            inputSample[c] = (o[0][c] + o[1][c] + o[2][c] + o[3][c]) * 0.125;
+        }
+
+        /* and take the final combined sum of outputs */
+        for (c = 0; c < 2; c++) {
+            SKFLT *lastRef[7];
+            SKFLT in;
+
+            for (k = 0; k < 7; k++) lastRef[k] = &v->lastRef[k][c];
+            in = inputSample[c];
+
+            if (p->cycleEnd == 4) {
+                /* start from previous last */
+                *lastRef[0] = *lastRef[4];
+                /* half */
+                *lastRef[2] = (*lastRef[0] + in) * 0.5;
+                /* one quarter */
+                *lastRef[1] = (*lastRef[0] + *lastRef[2]) * 0.5;
+                /* three quarters */
+                *lastRef[3] = (*lastRef[2] + in) * 0.5;
+                /* full */
+                *lastRef[4] = in;
+            }
+
+            if (p->cycleEnd == 3) {
+                /* start from previous last */
+                *lastRef[0] = *lastRef[3];
+                /* third */
+                *lastRef[2] = (*lastRef[0]+*lastRef[0]+in) * 0.33333;
+                /* two thirds */
+                *lastRef[1] = (*lastRef[0]+in+in) * 0.33333;
+                /* full */
+                *lastRef[3] = in;
+            }
+
+            if (p->cycleEnd == 2) {
+                /* start from previous last */
+                *lastRef[0] = *lastRef[2];
+                /* half */
+                *lastRef[1] = (*lastRef[0] + in) * 0.5;
+                /* full */
+                *lastRef[2] = in;
+            }
         }
+
         v->cycle = 0; /* reset */
     } else {
-        inputSampleL = v->lastRefL[v->cycle];
-        inputSampleR = v->lastRefR[v->cycle];
+        for (c = 0; c < 2; c++) {
+            inputSample[c] = v->lastRef[v->cycle][c];
+        }
         /* we are going through our references now */
     }
 
-    if (fabs(v->iirBL)<1.18e-37) v->iirBL = 0.0;
-    v->iirBL = (v->iirBL*(1.0-lowpass))+(inputSampleL*lowpass);
-    inputSampleL = v->iirBL;
-    if (fabs(v->iirBR)<1.18e-37) v->iirBR = 0.0;
-    v->iirBR = (v->iirBR*(1.0-lowpass))+(inputSampleR*lowpass);
-    inputSampleR = v->iirBR;
+    for (c = 0; c < 2; c++) {
+        if (fabs(v->iirB[c])<1.18e-37) v->iirB[c] = 0.0;
+        v->iirB[c] = (v->iirB[c]*(1.0-lowpass))+(inputSample[c]*lowpass);
+        inputSample[c] = v->iirB[c];
+    }
+
+    *outL = inputSample[0];
+    *outR = inputSample[1];
+}
+
+void sk_verbity_tick(sk_verbity *v,
+                     SKFLT *inL, SKFLT *inR,
+                     SKFLT *outL, SKFLT *outR)
+{
+    struct verbity_params p;
+
+    params(v, &p);
+    reverb(v, &p, *inL, *inR, outL, outR);
+}
+
+void sk_verbity_compute(sk_verbity *v, int n,
+                        const SKFLT *inL, const SKFLT *inR,
+                        SKFLT *outL, SKFLT *outR)
+{
+    struct verbity_params p;
+    int i;
+
+    params(v, &p);
 
-    *outL = inputSampleL;
-    *outR = inputSampleR;
+    for (i = 0; i < n; i++) {
+        reverb(v, &p, inL[i], inR[i], &outL[i], &outR[i]);
+    }
 }
 
 void sk_verbity_bigness(sk_verbity *c, SKFLT bigness)
@@ -478,9 +373,14 @@ struct verbity_n {
     gf_cable *longness;
     gf_cable *darkness;
     gf_cable *out[2];
-    sk_verbity v;
+    sk_verbity *v;
 };
 
+static int control_rate(gf_cable *c)
+{
+    return gf_cable_is_constant(c) || gf_cable_is_krate(c);
+}
+
 static void compute(gf_node *node)
 {
     int blksize;
@@ -491,6 +391,25 @@ static void compute(gf_node *node)
 
     vd = (struct verbity_n *)gf_node_get_data(node);
 
+    if (control_rate(vd->bigness) &&
+        control_rate(vd->longness) &&
+        control_rate(vd->darkness)) {
+        GFFLT *out[2];
+
+        out[0] = gf_cable_data(vd->out[0]);
+        out[1] = gf_cable_data(vd->out[1]);
+
+        sk_verbity_bigness(vd->v, gf_cable_kget(vd->bigness));
+        sk_verbity_longness(vd->v, gf_cable_kget(vd->longness));
+        sk_verbity_darkness(vd->v, gf_cable_kget(vd->darkness));
+
+        sk_verbity_compute(vd->v, blksize,
+                           gf_cable_input(vd->in[0], out[0], blksize),
+                           gf_cable_input(vd->in[1], out[1], blksize),
+                           out[0], out[1]);
+        return;
+    }
+
     for (n = 0; n < blksize; n++) {
         GFFLT in[2], out[2];
         GFFLT bigness, longness, darkness;
@@ -499,15 +418,15 @@ static void compute(gf_node *node)
         in[1] = gf_cable_get(vd->in[1], n);
 
         bigness = gf_cable_get(vd->bigness, n);
-        sk_verbity_bigness(&vd->v, bigness);
+        sk_verbity_bigness(vd->v, bigness);
         longness = gf_cable_get(vd->longness, n);
-        sk_verbity_longness(&vd->v, longness);
+        sk_verbity_longness(vd->v, longness);
         darkness = gf_cable_get(vd->darkness, n);
-        sk_verbity_darkness(&vd->v, darkness);
+        sk_verbity_darkness(vd->v, darkness);
 
-        sk_verbity_compute(&vd->v,
-                           &in[0], &in[1],
-                           &out[0], &out[1]);
+        sk_verbity_tick(vd->v,
+                        &in[0], &in[1],
+                        &out[0], &out[1]);
 
         gf_cable_set(vd->out[0], n, out[0]);
         gf_cable_set(vd->out[1], n, out[1]);
@@ -523,6 +442,7 @@ static void destroy(gf_node *node)
     if (rc != GF_OK) return;
     gf_node_cables_free(node);
     ud = gf_node_get_data(node);
+    sk_verbity_del(((struct verbity_n *)ud)->v);
     gf_memory_free(patch, &ud);
 }
 
@@ -557,7 +477,12 @@ int sk_node_verbity(sk_core *core)
     verbity = (struct verbity_n *)ud;
 
     sr = gf_patch_srate_get(patch);
-    sk_verbity_init(&verbity->v, sr);
+    verbity->v = sk_verbity_new(sr);
+
+    if (verbity->v == NULL) {
+        gf_memory_free(patch, &ud);
+        return 1;
+    }
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
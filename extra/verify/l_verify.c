@@ -7,7 +7,6 @@
 #include "sklil.h"
 
 int sk_verify(sk_core *core, char *out);
-void lil_set_errcode(int err);
 
 static lil_value_t l_verify(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -34,7 +33,7 @@ static lil_value_t l_verify(lil_t lil, size_t argc, lil_value_t *argv)
         char str[128];
         sprintf(str, "expected %s, got %s", cmp, md5);
         lil_set_error(lil, str);
-        lil_set_errcode(1);
+        lil_set_errcode(lil, 1);
         return NULL;
     }
 
@@ -32,13 +32,10 @@ int sk_verify(sk_core *core, char *out)
     int rc;
     gf_patch *patch;
     gf_cable *c;
+    int blksize;
 
     patch = sk_core_patch(core);
-
-    if (gf_patch_blksize(patch) != 64) {
-        fprintf(stderr, "block size should be 64\n");
-        return 1;
-    }
+    blksize = gf_patch_blksize(patch);
 
     rc = sk_param_get_cable(core, &in);
     SK_ERROR_CHECK(rc);
@@ -47,14 +44,15 @@ int sk_verify(sk_core *core, char *out)
 
     SK_ERROR_CHECK(rc);
 
+    /* always the same number of samples, whatever the block size */
     nsmps = 64 * 3446;
 
     buf = calloc(1, nsmps * sizeof(SKFLT));
 
-    for (n = 0; n < 3446; n++) {
+    for (n = 0; n < nsmps; n += blksize) {
         sk_core_compute(core);
-        for (i = 0; i < 64; i++) {
-            buf[n*64 + i] = gf_cable_get(c, i);
+        for (i = 0; i < blksize && n + i < nsmps; i++) {
+            buf[n + i] = gf_cable_get(c, i);
         }
     }
 
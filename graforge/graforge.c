@@ -1,7 +1,26 @@
+#ifdef GF_PROFILE
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "graforge.h"
 
+#ifdef GF_PROFILE
+#include <time.h>
+#endif
+
+#if defined(__plan9__) && !defined(GF_NOTHREADS)
+#define GF_NOTHREADS
+#endif
+
+#ifndef GF_NOTHREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 struct gf_pointer {
     gf_patch *patch;
     int type;
@@ -14,8 +33,22 @@ struct gf_buffer {
     int id;
     int read;
     GFFLT *buf;
+    int list;
+    gf_buffer *prev;
+    gf_buffer *next;
 };
 
+#ifdef GF_PROFILE
+#define PROF_NBUCKETS 128
+#define PROF_TAGSIZE 16
+
+typedef struct {
+    unsigned long nblocks;
+    double total; /* nanoseconds */
+    unsigned long hist[PROF_NBUCKETS];
+} gf_prof;
+#endif
+
 struct gf_node {
     gf_patch *patch;
     int id;
@@ -27,20 +60,36 @@ struct gf_node {
     int blksize;
     int type;
     int group;
+    int flags;
     gf_node *next;
+#ifdef GF_PROFILE
+    char tag[PROF_TAGSIZE];
+    gf_prof prof;
+#endif
+};
+
+/* every pool buffer lives on exactly one of these lists */
+enum {
+    BUFLIST_NONE,
+    BUFLIST_FREE,
+    BUFLIST_BUSY,
+    BUFLIST_HELD,
+    BUFLIST_END
 };
 
 struct gf_bufferpool {
     gf_buffer *buffers;
     int size;
     int nactive;
-    int last_free;
     int usrnactive;
+    gf_buffer *lists[BUFLIST_END];
+    int peak;
 };
 
 struct gf_stack {
     int pos;
     int size;
+    int peak;
     gf_bufferpool *pool;
     gf_buffer **buffers;
 };
@@ -48,8 +97,11 @@ struct gf_stack {
 struct gf_patch {
     gf_node *nodes;
     gf_node *last;
+    gf_node *prevlast;
     int nnodes;
+    unsigned long generation;
     int blksize;
+    int maxblksize;
     int counter;
     int nodepos;
     gf_pointerlist plist;
@@ -61,6 +113,15 @@ struct gf_patch {
     gf_mallocfun malloc;
     gf_freefun free;
     void (*print)(gf_patch *, const char *fmt, va_list);
+    gf_sched *sched;
+    gf_arena *arena;
+    const char *tag;
+    int subpos;
+    int sublen;
+    int klerp;
+#ifdef GF_PROFILE
+    int profile;
+#endif
 };
 
 size_t gf_node_size(void)
@@ -68,6 +129,16 @@ size_t gf_node_size(void)
     return sizeof(gf_node);
 }
 
+static int sched_compute(gf_sched *s);
+static void arena_release(gf_patch *patch);
+static int scratch_alloc(gf_patch *p, size_t size, void **ud);
+static int scratch_free(gf_patch *p, void **ud);
+static int has_data(gf_cable *cable);
+#ifdef GF_PROFILE
+static void prof_init(gf_node *node, const char *tag);
+static void prof_compute(gf_node *node);
+#endif
+
 static void empty(gf_node *node)
 {
 }
@@ -86,6 +157,7 @@ void gf_node_init(gf_node *node, int blksize)
     node->blksize = blksize;
     node->type = -1;
     node->group = -1;
+    node->flags = 0;
     node->next = NULL;
 }
 
@@ -110,9 +182,41 @@ void gf_node_set_destroy(gf_node *node, gf_function fun)
 }
 
 
+/*
+ * moves a node's blocks along to the sub-block being
+ * computed (or back, with dir -1), see gf_patch_compute_sub
+ */
+
+static void node_shift(gf_node *node, int dir)
+{
+    int c;
+    gf_cable *cab;
+    gf_patch *patch;
+
+    patch = node->patch;
+
+    for (c = 0; c < node->ncables; c++) {
+        cab = &node->cables[c];
+        if (!has_data(cab)) continue;
+        cab->val += dir * (patch->subpos * cab->blksize / patch->blksize);
+    }
+}
+
 void gf_node_compute(gf_node *node)
 {
+    int shift;
+
+    if (node->flags & GF_NODE_DEAD) return;
+
+    shift = node->patch->subpos != 0;
+    if (shift) node_shift(node, 1);
+#ifdef GF_PROFILE
+    if (node->patch->profile) prof_compute(node);
+    else node->compute(node);
+#else
     node->compute(node);
+#endif
+    if (shift) node_shift(node, -1);
 }
 
 void gf_node_destroy(gf_node *node)
@@ -178,6 +282,11 @@ int gf_node_get_cable(gf_node *node, int id, gf_cable ** cable)
 
 int gf_node_blksize(gf_node *node)
 {
+    int len;
+
+    len = node->patch->sublen;
+    if (len > 0) len = len * node->blksize / node->patch->blksize;
+    if (len > 0 && len < node->blksize) return len;
     return node->blksize;
 }
 
@@ -213,6 +322,16 @@ void gf_node_set_type(gf_node *node, int type)
     node->type = type;
 }
 
+int gf_node_get_flags(gf_node *node)
+{
+    return node->flags;
+}
+
+void gf_node_set_flags(gf_node *node, int flags)
+{
+    node->flags = flags;
+}
+
 void gf_node_set_patch(gf_node *node, gf_patch *patch)
 {
     node->patch = patch;
@@ -235,11 +354,32 @@ void gf_node_set_next(gf_node *node, gf_node *next)
 }
 
 
+/* Control Rate
+ *
+ * A control-rate (k-rate) output is computed once per block,
+ * for things that only move slowly: envelopes, LFOs, pitch.
+ * There are two kinds. CABLE_KRATE holds one value for the
+ * whole block, in ival, and reads just like a constant.
+ * CABLE_KLERP ramps from the last value to the new one over
+ * the block, so audio-rate readers don't hear steps. The
+ * ramp lives in a small block owned by the cable, not on
+ * the buffer stack, and reads like any other block.
+ */
+
 enum {
     CABLE_IVAL,
-    CABLE_BLOCK
+    CABLE_BLOCK,
+    CABLE_KRATE,
+    CABLE_KLERP
 };
 
+/* block data to read from, as opposed to a single value */
+
+static int has_data(gf_cable *cable)
+{
+    return cable->type == CABLE_BLOCK || cable->type == CABLE_KLERP;
+}
+
 void gf_cable_init(gf_node *node, gf_cable *cable)
 {
     cable->ival = 0;
@@ -250,12 +390,17 @@ void gf_cable_init(gf_node *node, gf_cable *cable)
     cable->node = node;
     cable->pcable = cable;
     cable->buf = NULL;
+    cable->silent = 0;
 }
 
 void gf_cable_free(gf_cable *cable)
 {
-    if (cable->blksize != 0) {
+    void *blk;
 
+    if (cable->type == CABLE_KLERP && cable->pcable == cable) {
+        blk = cable->blk;
+        gf_memory_free(cable->node->patch, &blk);
+        cable->blk = NULL;
     }
 }
 
@@ -281,22 +426,190 @@ void gf_cable_set_value(gf_cable *c, GFFLT val)
 
 GFFLT gf_cable_get(gf_cable *cable, int pos)
 {
-    if (cable->type == CABLE_IVAL) {
-        return *cable->val;
-    } else {
+    if (has_data(cable)) {
         return cable->val[pos];
+    } else {
+        return *cable->val;
     }
 }
 
 void gf_cable_set(gf_cable *cable, int pos, GFFLT val)
 {
-    if (cable->type == CABLE_IVAL) {
+    if (!has_data(cable)) {
         *cable->val = val;
     } else {
         cable->val[pos] = val;
     }
 }
 
+GFFLT *gf_cable_data(gf_cable *cable)
+{
+    if (!has_data(cable)) return NULL;
+    return cable->val;
+}
+
+GFFLT *gf_cable_input(gf_cable *cable, GFFLT *tmp, int blksize)
+{
+    int n;
+
+    if (has_data(cable)) return cable->val;
+
+    for (n = 0; n < blksize; n++) {
+        tmp[n] = *cable->val;
+    }
+
+    return tmp;
+}
+
+void gf_cable_view(gf_cable *cable, gf_view *view)
+{
+    view->ptr = cable->val;
+    view->stride = has_data(cable) ? 1 : 0;
+}
+
+/* Silence
+ *
+ * A node that knows its output block is all zeros can mark
+ * the cable silent, so nodes reading it can skip work. The
+ * flag lives on the cable that owns the block; input cables
+ * look it up through pcable. Only the owner may set it;
+ * a node that writes into someone else's cable (cabclr)
+ * must leave the flag alone, since the owner has no reason
+ * to clear it again. Nodes that never set it are never
+ * considered silent.
+ *
+ * A constant is silent when it is 0.
+ */
+
+static gf_cable *cable_root(gf_cable *cable)
+{
+    while (cable->pcable != cable) cable = cable->pcable;
+    return cable;
+}
+
+/* the part of the block being computed right now */
+
+static int cable_len(gf_cable *cable)
+{
+    gf_patch *patch;
+    int len;
+
+    if (cable->node == NULL) return cable->blksize;
+
+    patch = cable->node->patch;
+    len = patch->sublen;
+    if (len > 0) len = len * cable->blksize / patch->blksize;
+    if (len > 0 && len < cable->blksize) return len;
+    return cable->blksize;
+}
+
+int gf_cable_silent(gf_cable *cable)
+{
+    if (!has_data(cable)) return *cable->val == 0;
+    return cable_root(cable)->silent;
+}
+
+void gf_cable_silent_set(gf_cable *cable, int silent)
+{
+    cable_root(cable)->silent = silent;
+}
+
+void gf_cable_silence(gf_cable *cable)
+{
+    int n;
+    int blksize;
+
+    if (!gf_cable_is_block(cable)) return;
+
+    blksize = cable_len(cable);
+    for (n = 0; n < blksize; n++) cable->val[n] = 0;
+    cable_root(cable)->silent = 1;
+}
+
+/* for nodes that only sometimes write zeros: checks the block */
+
+int gf_cable_silent_update(gf_cable *cable)
+{
+    int n;
+    int silent;
+    int blksize;
+
+    if (!gf_cable_is_block(cable)) return gf_cable_silent(cable);
+
+    blksize = cable_len(cable);
+    silent = 1;
+    for (n = 0; n < blksize; n++) {
+        if (cable->val[n] != 0) {
+            silent = 0;
+            break;
+        }
+    }
+
+    cable_root(cable)->silent = silent;
+    return silent;
+}
+
+/* Tails
+ *
+ * Stateful nodes keep ringing after their input goes
+ * silent. A gf_tail counts how long the input has been
+ * silent and the output has stayed under GF_TAIL_THRESH.
+ * Once that reaches hold samples, gf_tail_skip returns 1
+ * and the node can write silence instead of computing,
+ * until the input wakes up again.
+ *
+ * hold should be at least as long as the longest delay
+ * inside the node, so a quiet stretch in the middle of an
+ * echo isn't taken for the end of the tail. It must be
+ * more than 0. Nodes whose ring depends on their
+ * parameters can change it with gf_tail_hold.
+ */
+
+void gf_tail_init(gf_tail *t, int hold)
+{
+    t->hold = hold;
+    t->count = 0;
+    t->quiet = 0;
+}
+
+void gf_tail_hold(gf_tail *t, int hold)
+{
+    t->hold = hold;
+}
+
+int gf_tail_skip(gf_tail *t, int silent, int blksize)
+{
+    /* the last block was silent in, quiet out */
+    if (t->quiet) t->count += blksize;
+    t->quiet = 0;
+
+    if (!silent) {
+        t->count = 0;
+        return 0;
+    }
+
+    if (t->count >= t->hold) return 1;
+
+    /* gf_tail_check clears this if the output is loud */
+    t->quiet = 1;
+    return 0;
+}
+
+void gf_tail_check(gf_tail *t, GFFLT *out, int blksize)
+{
+    int n;
+
+    if (!t->quiet) return;
+
+    for (n = 0; n < blksize; n++) {
+        if (out[n] > GF_TAIL_THRESH || out[n] < -GF_TAIL_THRESH) {
+            t->quiet = 0;
+            t->count = 0;
+            return;
+        }
+    }
+}
+
 int gf_cable_connect(gf_cable *c1, gf_cable *c2)
 {
     int id1, id2;
@@ -354,6 +667,88 @@ int gf_cable_is_constant(gf_cable *cab)
     return cab->type == CABLE_IVAL;
 }
 
+int gf_cable_is_krate(gf_cable *cab)
+{
+    return cab->type == CABLE_KRATE || cab->type == CABLE_KLERP;
+}
+
+/*
+ * Makes cable id of node a control-rate output. Whether it
+ * ramps depends on the patch setting when this is called.
+ */
+
+int gf_node_set_krate(gf_node *node, int id)
+{
+    gf_cable *cab;
+    void *blk;
+    int n;
+
+    if (id >= node->ncables) return GF_INVALID_CABLE;
+
+    cab = &node->cables[id];
+    cab->ival = 0;
+    cab->val = &cab->ival;
+    cab->blksize = node->blksize;
+    cab->type = CABLE_KRATE;
+
+    if (!node->patch->klerp) return GF_OK;
+
+    blk = NULL;
+    if (gf_memory_alloc(node->patch,
+                        sizeof(GFFLT) * node->blksize,
+                        &blk) != GF_OK) {
+        return GF_NOT_OK;
+    }
+
+    cab->blk = blk;
+    cab->val = cab->blk;
+    cab->type = CABLE_KLERP;
+    for (n = 0; n < node->blksize; n++) cab->blk[n] = 0;
+
+    return GF_OK;
+}
+
+/* writes this block's value to a control-rate output */
+
+void gf_cable_kset(gf_cable *cable, GFFLT val)
+{
+    GFFLT prev;
+    GFFLT step;
+    int len;
+    int n;
+
+    prev = cable->ival;
+    cable->ival = val;
+
+    if (cable->type != CABLE_KLERP) return;
+
+    len = cable_len(cable);
+    step = (val - prev) / len;
+
+    for (n = 0; n < len; n++) {
+        cable->val[n] = prev + step * (n + 1);
+    }
+
+    cable->silent = prev == 0 && val == 0;
+}
+
+/*
+ * The value of an input for the whole block, for nodes
+ * running at control rate. Audio-rate inputs give their
+ * last sample.
+ */
+
+GFFLT gf_cable_kget(gf_cable *cable)
+{
+    if (cable->type == CABLE_BLOCK) {
+        return cable->val[cable_len(cable) - 1];
+    } else if (cable->type == CABLE_KLERP) {
+        return cable_root(cable)->ival;
+    }
+
+    return *cable->val;
+}
+
 gf_buffer *gf_cable_get_buffer(gf_cable *cab)
 {
     return cab->buf;
@@ -385,10 +780,12 @@ int gf_cable_make_block(gf_cable *cable, gf_stack *stack, int blksize)
 int gf_cable_clear(gf_cable *cab)
 {
     int i;
+    int blksize;
     if (!gf_cable_is_block(cab))
 	return GF_NOT_OK;
 
-    for (i = 0; i < cab->blksize; i++) {
+    blksize = cable_len(cab);
+    for (i = 0; i < blksize; i++) {
 	cab->val[i] = 0;
     }
 
@@ -398,11 +795,13 @@ int gf_cable_clear(gf_cable *cab)
 int gf_cable_mix(gf_cable *in, gf_cable *sum, GFFLT mix)
 {
     int i;
-    if (!gf_cable_is_block(in) || !gf_cable_is_block(sum))
+    int blksize;
+    if (gf_cable_is_constant(in) || !gf_cable_is_block(sum))
 	return GF_NOT_OK;
 
-    for (i = 0; i < sum->blksize; i++) {
-	sum->val[i] += in->val[i] *mix;
+    blksize = cable_len(sum);
+    for (i = 0; i < blksize; i++) {
+	sum->val[i] += gf_cable_get(in, i) *mix;
     }
 
     return GF_OK;
@@ -426,7 +825,7 @@ void gf_cable_copy(gf_cable *c1, gf_cable *c2)
     int n;
     GFFLT tmp;
 
-    blksize = c1->blksize;
+    blksize = cable_len(c1);
 
     for (n = 0; n < blksize; n++) {
 	tmp = gf_cable_get(c1, n);
@@ -569,6 +968,9 @@ void gf_buffer_free(gf_patch *patch, gf_buffer *buf)
 void gf_buffer_init(gf_buffer *buf)
 {
     buf->id = -1;
+    buf->list = BUFLIST_NONE;
+    buf->prev = NULL;
+    buf->next = NULL;
     gf_buffer_reinit(buf);
 }
 
@@ -625,11 +1027,39 @@ int gf_buffer_id(gf_buffer *buf)
     return buf->id;
 }
 
+/* moves a buffer to the front of a list in constant time,
+ * keeping nactive in sync with the free list. Buffers that
+ * don't belong to the pool (id < 0) are left alone.
+ */
+static void buffer_move(gf_bufferpool *pool, gf_buffer *buf, int list)
+{
+    if (buf->id < 0 || buf->list == list) return;
+
+    if (buf->prev != NULL) buf->prev->next = buf->next;
+    else pool->lists[buf->list] = buf->next;
+    if (buf->next != NULL) buf->next->prev = buf->prev;
+
+    if (buf->list == BUFLIST_FREE) pool->nactive++;
+    if (list == BUFLIST_FREE) pool->nactive--;
+
+    buf->list = list;
+    buf->prev = NULL;
+    buf->next = pool->lists[list];
+    if (buf->next != NULL) buf->next->prev = buf;
+    pool->lists[list] = buf;
+
+    if (pool->nactive > pool->peak) pool->peak = pool->nactive;
+}
+
 void gf_bufferpool_init(gf_bufferpool *pool)
 {
+    int i;
+    pool->buffers = NULL;
     pool->size = 0;
     pool->nactive = 0;
     pool->usrnactive = 0;
+    pool->peak = 0;
+    for (i = 0; i < BUFLIST_END; i++) pool->lists[i] = NULL;
 }
 
 void gf_bufferpool_create(gf_patch *patch,
@@ -638,27 +1068,31 @@ void gf_bufferpool_create(gf_patch *patch,
     int i;
     pool->size = nbuf;
     pool->nactive = 0;
+    for (i = 0; i < BUFLIST_END; i++) pool->lists[i] = NULL;
     gf_memory_alloc(patch,
 		    sizeof(gf_buffer) *nbuf, (void **) &pool->buffers);
 
-    for (i = 0; i < nbuf; i++) {
+    /* added in reverse, so the lowest ids get handed out first */
+    for (i = nbuf - 1; i >= 0; i--) {
 	gf_buffer_alloc(patch, &pool->buffers[i], blksize);
 	gf_buffer_init(&pool->buffers[i]);
 	pool->buffers[i].id = i;
+	pool->buffers[i].list = BUFLIST_FREE;
+	pool->buffers[i].next = pool->lists[BUFLIST_FREE];
+	if (pool->buffers[i].next != NULL)
+	    pool->buffers[i].next->prev = &pool->buffers[i];
+	pool->lists[BUFLIST_FREE] = &pool->buffers[i];
     }
 }
 
 void gf_bufferpool_reset(gf_bufferpool *pool)
 {
-    int i;
-    pool->last_free = -1;
-    pool->nactive = 0;
-    for (i = 0; i < pool->size; i++) {
-        if (pool->buffers[i].read >= 0) {
-            gf_buffer_reinit(&pool->buffers[i]);
-        } else {
-            pool->nactive++;
-        }
+    gf_buffer *buf;
+
+    /* held buffers stay active, everything else is freed */
+    while ((buf = pool->lists[BUFLIST_BUSY]) != NULL) {
+        gf_buffer_reinit(buf);
+        buffer_move(pool, buf, BUFLIST_FREE);
     }
 }
 
@@ -680,11 +1114,16 @@ int gf_bufferpool_nactive(gf_bufferpool *pool)
     return pool->nactive;
 }
 
+int gf_bufferpool_peak(gf_bufferpool *pool)
+{
+    return pool->peak;
+}
+
 int gf_bufferpool_unhold(gf_bufferpool *pool, gf_buffer *buf)
 {
     if (buf->id < 0) return 0;
     if (gf_buffer_unhold(buf)) {
-        pool->nactive--;
+        buffer_move(pool, buf, BUFLIST_FREE);
         return 1;
     } else {
         return 0;
@@ -693,23 +1132,14 @@ int gf_bufferpool_unhold(gf_bufferpool *pool, gf_buffer *buf)
 
 int gf_bufferpool_nextfree(gf_bufferpool *pool, gf_buffer ** buf)
 {
-    int i;
-    if (pool->nactive >= pool->size) {
-        return GF_POOL_FULL;
-    } else if (pool->last_free >= 0) {
-        *buf = &pool->buffers[pool->last_free];
-        pool->last_free = -1;
-    } else {
-        for (i = 0; i < pool->size; i++) {
-            if (pool->buffers[i].read == 0) {
-                *buf = &pool->buffers[i];
-                break;
-            }
-        }
-    }
+    gf_buffer *b;
 
-    pool->nactive++;
-    gf_buffer_mark(*buf);
+    b = pool->lists[BUFLIST_FREE];
+    if (b == NULL) return GF_POOL_FULL;
+
+    buffer_move(pool, b, BUFLIST_BUSY);
+    gf_buffer_mark(b);
+    *buf = b;
 
     return GF_OK;
 }
@@ -719,8 +1149,8 @@ int gf_bufferpool_holdu(gf_bufferpool *pool, gf_buffer *buf)
     if (buf == NULL) return GF_NULL_VALUE;
     if (buf->read >= 0) {
         gf_buffer_holdu(buf);
+        buffer_move(pool, buf, BUFLIST_HELD);
         pool->usrnactive++;
-        pool->nactive++;
         return GF_OK;
     }
     return GF_INVALID_BUFFER;
@@ -732,17 +1162,20 @@ int gf_bufferpool_unholdu(gf_bufferpool *pool, gf_buffer *buf)
     if (buf->id == -1) return GF_OK;
     if (buf->read != -2) return GF_INVALID_BUFFER;
     if (!gf_buffer_unhold(buf)) return GF_NOT_OK;
-    pool->nactive--;
+    buffer_move(pool, buf, BUFLIST_FREE);
     pool->usrnactive--;
     return GF_OK;
 }
 
 int gf_bufferpool_unholdu_all(gf_bufferpool *pool)
 {
-    int i;
+    gf_buffer *buf, *next;
     if (pool->usrnactive == 0) return GF_NOT_OK;
-    for (i = 0; i < pool->size; i++) {
-        gf_bufferpool_unholdu(pool, &pool->buffers[i]);
+    buf = pool->lists[BUFLIST_HELD];
+    while (buf != NULL) {
+        next = buf->next;
+        gf_bufferpool_unholdu(pool, buf);
+        buf = next;
     }
     return GF_OK;
 }
@@ -754,7 +1187,8 @@ int gf_bufferpool_uactive(gf_bufferpool *pool)
 
 void gf_bufferpool_clear_last_free(gf_bufferpool *pool)
 {
-    pool->last_free = -1;
+    /* no-op: the free list makes this unnecessary */
+    (void)pool;
 }
 
 void gf_stack_init(gf_stack *stack, gf_bufferpool *pool)
@@ -762,6 +1196,7 @@ void gf_stack_init(gf_stack *stack, gf_bufferpool *pool)
     stack->pool = pool;
     stack->pos = 0;
     stack->size = 0;
+    stack->peak = 0;
 }
 
 int gf_stack_alloc(gf_patch *patch, gf_stack *stack, int size)
@@ -795,6 +1230,7 @@ int gf_stack_push(gf_stack *stack, gf_buffer ** buf)
 
     stack->buffers[stack->pos] = pbuf;
     stack->pos++;
+    if (stack->pos > stack->peak) stack->peak = stack->pos;
     if (buf != NULL)
 	*buf = pbuf;
     return GF_OK;
@@ -807,6 +1243,7 @@ int gf_stack_push_buffer(gf_stack *stack, gf_buffer *buf)
     }
     stack->buffers[stack->pos] = buf;
     stack->pos++;
+    if (stack->pos > stack->peak) stack->peak = stack->pos;
     return GF_OK;
 }
 
@@ -830,8 +1267,7 @@ int gf_stack_pop(gf_stack *stack, gf_buffer ** buf)
 
     rc = gf_buffer_unmark(tmp);
     if (rc >= 0) {
-	stack->pool->last_free = rc;
-	stack->pool->nactive--;
+	buffer_move(stack->pool, tmp, BUFLIST_FREE);
     }
     if (buf != NULL)
 	*buf = tmp;
@@ -853,6 +1289,7 @@ int gf_stack_dup(gf_stack *stack)
     buf = stack->buffers[stack->pos];
     gf_buffer_mark(buf);
     stack->pos++;
+    if (stack->pos > stack->peak) stack->peak = stack->pos;
     return GF_OK;
 }
 
@@ -882,6 +1319,7 @@ int gf_stack_hold(gf_stack *stack, gf_buffer ** buf)
 	return GF_NOT_OK;
     }
     gf_buffer_hold(*buf);
+    buffer_move(stack->pool, *buf, BUFLIST_HELD);
     return GF_OK;
 }
 
@@ -896,6 +1334,11 @@ int gf_stack_pos(gf_stack *stack)
     return stack->pos;
 }
 
+int gf_stack_peak(gf_stack *stack)
+{
+    return stack->peak;
+}
+
 void gf_stack_reset(gf_stack *stack)
 {
     stack->pos = 0;
@@ -904,16 +1347,27 @@ void gf_stack_reset(gf_stack *stack)
 void gf_patch_init(gf_patch *patch, int blksize)
 {
     patch->blksize = blksize;
+    patch->maxblksize = blksize;
     gf_bufferpool_init(&patch->pool);
     gf_patch_srate_set(patch, 44100);
     gf_memory_defaults(patch);
     gf_print_init(patch);
+    patch->sched = NULL;
+    patch->arena = NULL;
+    patch->tag = NULL;
+    patch->subpos = 0;
+    patch->sublen = 0;
+    patch->klerp = 1;
+    patch->generation = 0;
+#ifdef GF_PROFILE
+    patch->profile = 0;
+#endif
     gf_patch_reinit(patch);
 }
 
 void gf_patch_alloc(gf_patch *patch, int nbuffers, int stack_size)
 {
-    gf_bufferpool_create(patch, &patch->pool, nbuffers, patch->blksize);
+    gf_bufferpool_create(patch, &patch->pool, nbuffers, patch->maxblksize);
     gf_bufferpool_reset(&patch->pool);
     gf_stack_init(&patch->stack, &patch->pool);
     gf_stack_alloc(patch, &patch->stack, stack_size);
@@ -925,6 +1379,7 @@ void gf_patch_realloc(gf_patch *patch,
     gf_bufferpool_destroy(patch, &patch->pool);
     gf_stack_free(patch, &patch->stack);
     patch->blksize = blksize;
+    patch->maxblksize = blksize;
     gf_patch_alloc(patch, nbuffers, stack_size);
 }
 
@@ -945,7 +1400,9 @@ void gf_patch_clear(gf_patch *patch)
 {
     patch->nodes = NULL;
     patch->last = NULL;
+    patch->prevlast = NULL;
     patch->nnodes = 0;
+    patch->generation++;
     gf_pointerlist_init(&patch->plist);
 }
 
@@ -957,12 +1414,14 @@ void gf_patch_free_nodes(gf_patch *patch)
     node = patch->nodes;
     for (i = 0; i < patch->nnodes; i++) {
 	next = gf_node_get_next(node);
-	free(node);
+	gf_memory_free(patch, (void **) &node);
 	node = next;
     }
 
     patch->nnodes = 0;
-
+    patch->nodes = NULL;
+    patch->last = NULL;
+    patch->generation++;
 }
 
 void gf_patch_destroy(gf_patch *patch)
@@ -979,6 +1438,15 @@ void gf_patch_destroy(gf_patch *patch)
     gf_pointerlist_free(&patch->plist);
     gf_bufferpool_destroy(patch, &patch->pool);
     gf_stack_free(patch, &patch->stack);
+    gf_patch_threads(patch, 1);
+
+    if (patch->arena != NULL) {
+        /* the nodes go with the arena */
+        patch->nnodes = 0;
+        patch->nodes = NULL;
+        patch->last = NULL;
+        arena_release(patch);
+    }
 }
 
 void gf_patch_compute(gf_patch *patch)
@@ -986,6 +1454,11 @@ void gf_patch_compute(gf_patch *patch)
     int n;
     gf_node *node;
     gf_node *next;
+
+    if (patch->sched != NULL && sched_compute(patch->sched) == GF_OK) {
+        return;
+    }
+
     node = patch->nodes;
     for (n = 0; n < patch->nnodes; n++) {
 	next = gf_node_get_next(node);
@@ -994,6 +1467,38 @@ void gf_patch_compute(gf_patch *patch)
     }
 }
 
+/* Sub-blocks
+ *
+ * Computes only the samples [pos, pos + len) of the block.
+ * Nodes see a block of len samples, with their cables moved
+ * along to pos, so that the whole block gets stitched
+ * together from a few calls. Handy for landing events in
+ * the middle of a block.
+ *
+ * Nodes that keep pointers to block data between computes
+ * won't see the move. Nodes should get them from their
+ * cables every time.
+ *
+ * pos and len are in samples of the patch block size. Nodes
+ * and cables made with a bigger (or smaller) block size get
+ * the same part of their own blocks, scaled to fit. This is
+ * what lets an oversampled part of the patch be split too.
+ */
+
+void gf_patch_compute_sub(gf_patch *patch, int pos, int len)
+{
+    if (pos == 0 && len >= patch->blksize) {
+        gf_patch_compute(patch);
+        return;
+    }
+
+    patch->subpos = pos;
+    patch->sublen = len;
+    gf_patch_compute(patch);
+    patch->subpos = 0;
+    patch->sublen = 0;
+}
+
 size_t gf_patch_size(void)
 {
     return sizeof(gf_patch);
@@ -1017,16 +1522,22 @@ int gf_patch_new_node(gf_patch *patch, gf_node **node)
     gf_node_init(tmp, patch->blksize);
     gf_node_set_id(tmp, patch->nnodes);
     gf_node_set_patch(tmp, patch);
+#ifdef GF_PROFILE
+    prof_init(tmp, patch->tag);
+#endif
 
     if (patch->nnodes == 0) {
         patch->nodes = tmp;
+        patch->prevlast = NULL;
     } else {
         gf_node_set_next(patch->last, tmp);
+        patch->prevlast = patch->last;
     }
 
 
     patch->nnodes++;
     patch->last = tmp;
+    patch->generation++;
 
     *node = tmp;
 
@@ -1079,15 +1590,42 @@ int gf_patch_blksize(gf_patch *patch)
 
 int gf_patch_blksize_set(gf_patch *patch, int blksize)
 {
-    int maxsize;
+    if (blksize <= 0 || blksize > patch->maxblksize) {
+        return GF_NOT_OK;
+    }
+
+    patch->blksize = blksize;
+
+    return GF_OK;
+}
+
+int gf_patch_klerp(gf_patch *patch)
+{
+    return patch->klerp;
+}
+
+void gf_patch_klerp_set(gf_patch *patch, int klerp)
+{
+    patch->klerp = klerp;
+}
 
-    maxsize = 64; /* TODO: don't hardcode */
+int gf_patch_maxblksize(gf_patch *patch)
+{
+    return patch->maxblksize;
+}
 
-    if (blksize <= 0 || blksize > maxsize) {
+int gf_patch_maxblksize_set(gf_patch *patch, int blksize)
+{
+    /* buffers get reallocated, so nothing can be using them */
+    if (blksize <= 0) return GF_NOT_OK;
+    if (patch->nnodes > 0 || patch->pool.usrnactive > 0) {
         return GF_NOT_OK;
     }
 
-    patch->blksize = blksize;
+    gf_patch_realloc(patch,
+                     patch->pool.size,
+                     patch->stack.size,
+                     blksize);
 
     return GF_OK;
 }
@@ -1128,7 +1666,6 @@ void gf_patch_holdbuf(gf_patch *patch, gf_cable *c)
     pool = gf_patch_pool(patch);
     buf = gf_cable_get_buffer(c->pcable);
     gf_bufferpool_holdu(pool, buf);
-    gf_bufferpool_clear_last_free(pool);
 }
 
 void gf_patch_unholdbuf(gf_patch *patch, gf_cable *c)
@@ -1157,7 +1694,6 @@ int gf_patch_bhold(gf_patch *patch, gf_buffer ** b)
     if (rc != GF_OK)
 	return rc;
 
-    gf_bufferpool_clear_last_free(pool);
     gf_bufferpool_holdu(pool, buf);
 
     if (b != NULL)
@@ -1189,37 +1725,1035 @@ gf_node *gf_patch_last_node(gf_patch *patch)
     return patch->last;
 }
 
-void gf_print(gf_patch *p, const char *fmt, ...)
+int gf_patch_remove_last_node(gf_patch *patch)
 {
-    va_list args;
-    va_start(args, fmt);
-    p->print(p, fmt, args);
-    va_end(args);
-}
+    gf_node *node;
+    gf_node *prev;
+    int n;
 
-static void gf_print_default(gf_patch *p, const char *str, va_list args)
-{
-    vprintf(str, args);
-}
+    if (patch->nnodes <= 0) return GF_NOT_OK;
 
-void gf_print_init(gf_patch *p)
-{
-    p->print = gf_print_default;
+    node = patch->last;
+    prev = patch->prevlast;
+
+    if (prev == NULL && patch->nnodes > 1) {
+        /* only known right after a node is added */
+        prev = patch->nodes;
+        for (n = 0; n < patch->nnodes - 2; n++) prev = prev->next;
+    }
+
+    if (prev == NULL) {
+        patch->nodes = NULL;
+    } else {
+        prev->next = NULL;
+    }
+
+    patch->last = prev;
+    patch->prevlast = NULL;
+    patch->nnodes--;
+    patch->generation++;
+
+    gf_node_destroy(node);
+    gf_memory_free(patch, (void **) &node);
+
+    return GF_OK;
 }
 
-void gf_print_set(gf_patch *p,
-		  void (*print)(gf_patch *, const char *, va_list))
-{
-    p->print = print;
+/* Constant folding
+ *
+ * A node flagged with GF_NODE_STATELESS always produces the
+ * same output for the same inputs. If all its inputs are
+ * constants, it only needs to be computed once: the value
+ * it produces can be used as a constant instead, and the
+ * node thrown away.
+ *
+ * This only works right after the node is made, while it
+ * is still the last node and its output buffer is still
+ * on top of the buffer stack.
+ */
+
+int gf_patch_fold_node(gf_patch *patch, gf_node *node, GFFLT *val)
+{
+    int c;
+    gf_cable *cab;
+    gf_cable *out;
+    gf_buffer *buf;
+
+    if (!(node->flags & GF_NODE_STATELESS)) return GF_NOT_OK;
+    if (node != patch->last) return GF_NOT_OK;
+
+    out = NULL;
+    for (c = 0; c < node->ncables; c++) {
+        cab = &node->cables[c];
+        if (cab->pcable == cab && cab->type != CABLE_IVAL) {
+            if (out != NULL) return GF_NOT_OK;
+            out = cab;
+        } else if (cab->type != CABLE_IVAL) {
+            return GF_NOT_OK;
+        }
+    }
+
+    if (out == NULL) return GF_NOT_OK;
+
+    /* control-rate outputs don't have a buffer */
+    if (out->type == CABLE_BLOCK) {
+        if (patch->stack.pos <= 0) return GF_NOT_OK;
+        buf = patch->stack.buffers[patch->stack.pos - 1];
+        if (buf != out->buf) return GF_NOT_OK;
+    }
+
+    gf_node_compute(node);
+
+    if (out->type == CABLE_BLOCK) {
+        *val = out->val[0];
+        gf_stack_pop(&patch->stack, NULL);
+    } else {
+        *val = out->ival;
+    }
+
+    gf_patch_remove_last_node(patch);
+
+    return GF_OK;
 }
 
-void gf_subpatch_init(gf_subpatch *subpatch)
+/* Dependency graph
+ *
+ * Two nodes depend on one another if they touch the same
+ * cable memory and at least one of them writes to it
+ * (read-after-write, write-after-read, write-after-write).
+ * Output cables own their memory, input cables read what
+ * they are connected to. Nodes flagged with GF_NODE_SERIAL
+ * have side effects graforge can't see, and act as a
+ * barrier: everything before them finishes first, and
+ * everything after waits for them. Any ordering of this
+ * graph produces the same output as the serial list.
+ */
+
+/* memory regions touched by cables */
+
+struct graph_region {
+    GFFLT *key;
+    int writer;
+    int readers;
+};
+
+struct graph_reader {
+    int node;
+    int next;
+};
+
+static unsigned long graph_hash(GFFLT *key, unsigned long mask)
 {
-    subpatch->nnodes = 0;
-    gf_pointerlist_init(&subpatch->plist);
+    unsigned long h;
+    h = (unsigned long)key;
+    h ^= h >> 7;
+    h *= 2654435761UL;
+    return (h >> 4) & mask;
 }
 
-void gf_subpatch_save(gf_patch *patch, gf_subpatch *subpatch)
+static struct graph_region *graph_lookup(struct graph_region *tab,
+                                         unsigned long mask,
+                                         GFFLT *key)
+{
+    unsigned long pos;
+
+    pos = graph_hash(key, mask);
+
+    while (tab[pos].key != NULL && tab[pos].key != key) {
+        pos = (pos + 1) & mask;
+    }
+
+    if (tab[pos].key == NULL) {
+        tab[pos].key = key;
+        tab[pos].writer = -1;
+        tab[pos].readers = -1;
+    }
+
+    return &tab[pos];
+}
+
+static void add_edge(int from, int to,
+                     int *stamp,
+                     int *edges, int *nedges)
+{
+    if (from < 0 || from == to || stamp[from] == to) return;
+    stamp[from] = to;
+    edges[2 * (*nedges)] = from;
+    edges[2 * (*nedges) + 1] = to;
+    (*nedges)++;
+}
+
+/* builds the dependency graph for a list of nodes, as
+ * compressed successor lists. succ is allocated here, and is
+ * left NULL if there are no edges.
+ */
+static int graph_build(gf_patch *patch,
+                       gf_node **nodes, int nnodes,
+                       int *npred, int *succ_off, int **psucc)
+{
+    gf_node *node;
+    int ncables;
+    int n, c, i;
+    unsigned long tabsize;
+    struct graph_region *tab;
+    struct graph_reader *readers;
+    int nreaders;
+    int *stamp;
+    int *edges;
+    int nedges;
+    size_t maxedges;
+    int *since;
+    int nsince;
+    int barrier;
+    int *succ;
+
+    *psucc = NULL;
+    if (nnodes <= 0) return GF_OK;
+
+    tab = NULL;
+    readers = NULL;
+    stamp = NULL;
+    since = NULL;
+    edges = NULL;
+
+    ncables = 0;
+    for (n = 0; n < nnodes; n++) {
+        ncables += nodes[n]->ncables;
+    }
+
+    tabsize = 16;
+    while (tabsize < 2 * (unsigned long)ncables) tabsize <<= 1;
+
+    /* every cable contributes at most (1 + readers) edges,
+     * barriers at most one per node */
+    maxedges = 2 * (size_t)ncables + 2 * (size_t)nnodes;
+
+    scratch_alloc(patch, sizeof(struct graph_region) * tabsize,
+                    (void **)&tab);
+    scratch_alloc(patch, sizeof(struct graph_reader) * (ncables + 1),
+                    (void **)&readers);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&stamp);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&since);
+    scratch_alloc(patch, sizeof(int) * 2 * maxedges, (void **)&edges);
+
+    memset(tab, 0, sizeof(struct graph_region) * tabsize);
+
+    for (n = 0; n < nnodes; n++) stamp[n] = -1;
+
+    nreaders = 0;
+    nedges = 0;
+    nsince = 0;
+    barrier = -1;
+
+    for (n = 0; n < nnodes; n++) {
+        node = nodes[n];
+
+        if (node->flags & GF_NODE_SERIAL) {
+            for (i = 0; i < nsince; i++) {
+                add_edge(since[i], n, stamp, edges, &nedges);
+            }
+            add_edge(barrier, n, stamp, edges, &nedges);
+            barrier = n;
+            nsince = 0;
+            continue;
+        }
+
+        add_edge(barrier, n, stamp, edges, &nedges);
+
+        for (c = 0; c < node->ncables; c++) {
+            gf_cable *cab;
+            struct graph_region *r;
+
+            cab = &node->cables[c];
+            r = graph_lookup(tab, tabsize - 1, cab->val);
+
+            if (cab->pcable == cab) {
+                /* write: wait on last writer and all readers */
+                int rd;
+                add_edge(r->writer, n, stamp, edges, &nedges);
+                for (rd = r->readers; rd >= 0; rd = readers[rd].next) {
+                    add_edge(readers[rd].node, n, stamp, edges, &nedges);
+                }
+                r->writer = n;
+                r->readers = -1;
+            } else {
+                /* read: wait on last writer */
+                add_edge(r->writer, n, stamp, edges, &nedges);
+                readers[nreaders].node = n;
+                readers[nreaders].next = r->readers;
+                r->readers = nreaders;
+                nreaders++;
+            }
+        }
+
+        since[nsince++] = n;
+    }
+
+    /* convert edge list to compressed successor lists */
+
+    for (n = 0; n <= nnodes; n++) succ_off[n] = 0;
+    for (n = 0; n < nnodes; n++) npred[n] = 0;
+
+    for (i = 0; i < nedges; i++) {
+        succ_off[edges[2*i] + 1]++;
+        npred[edges[2*i + 1]]++;
+    }
+
+    for (n = 0; n < nnodes; n++) {
+        succ_off[n + 1] += succ_off[n];
+        stamp[n] = succ_off[n];
+    }
+
+    if (nedges > 0) {
+        scratch_alloc(patch, sizeof(int) * nedges, (void **)&succ);
+        for (i = 0; i < nedges; i++) {
+            succ[stamp[edges[2*i]]++] = edges[2*i + 1];
+        }
+        *psucc = succ;
+    }
+
+    scratch_free(patch, (void **)&tab);
+    scratch_free(patch, (void **)&readers);
+    scratch_free(patch, (void **)&stamp);
+    scratch_free(patch, (void **)&since);
+    scratch_free(patch, (void **)&edges);
+
+    return GF_OK;
+}
+
+/* Parallel scheduler
+ *
+ * The node list is analyzed once into a dependency graph.
+ * Every block, ready nodes are handed out to a pool of
+ * worker threads, each with its own deque. Workers pop
+ * from the bottom of their own deque and steal from the
+ * top of the others when they run dry.
+ */
+
+#ifndef GF_NOTHREADS
+typedef struct {
+    gf_sched *sched;
+    int *deque;
+    int top;
+    int bottom;
+    pthread_mutex_t lock;
+} gf_worker;
+#endif
+
+struct gf_sched {
+    gf_patch *patch;
+    int nthreads;
+
+    /* patch generation the graph was built for */
+    unsigned long built;
+    int nnodes;
+    gf_node **nodes;
+    int *npred;
+    int *pending;
+    int *succ_off;
+    int *succ;
+
+#ifndef GF_NOTHREADS
+    gf_worker *workers;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    int round;
+    int nidle;
+    int quit;
+    int remaining;
+#endif
+};
+
+#ifndef GF_NOTHREADS
+
+#ifdef __GNUC__
+#define GF_ATOMIC_DEC(x) __sync_sub_and_fetch(x, 1)
+#define GF_ATOMIC_GET(x) __sync_fetch_and_add(x, 0)
+#else
+static pthread_mutex_t atomic_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int atomic_dec(int *x)
+{
+    int v;
+    pthread_mutex_lock(&atomic_lock);
+    v = --(*x);
+    pthread_mutex_unlock(&atomic_lock);
+    return v;
+}
+
+static int atomic_get(int *x)
+{
+    int v;
+    pthread_mutex_lock(&atomic_lock);
+    v = *x;
+    pthread_mutex_unlock(&atomic_lock);
+    return v;
+}
+#define GF_ATOMIC_DEC(x) atomic_dec(x)
+#define GF_ATOMIC_GET(x) atomic_get(x)
+#endif
+
+static void sched_free_graph(gf_sched *s)
+{
+    gf_patch *patch;
+    int n;
+
+    patch = s->patch;
+
+    if (s->nnodes > 0) {
+        scratch_free(patch, (void **)&s->nodes);
+        scratch_free(patch, (void **)&s->npred);
+        scratch_free(patch, (void **)&s->pending);
+        scratch_free(patch, (void **)&s->succ_off);
+        if (s->succ != NULL) scratch_free(patch, (void **)&s->succ);
+        for (n = 0; n < s->nthreads; n++) {
+            scratch_free(patch, (void **)&s->workers[n].deque);
+        }
+    }
+
+    s->nnodes = 0;
+    s->succ = NULL;
+}
+
+static int sched_build_graph(gf_sched *s)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int nnodes;
+    int n;
+
+    patch = s->patch;
+    sched_free_graph(s);
+    s->built = patch->generation;
+
+    nnodes = patch->nnodes;
+    if (nnodes <= 0) return GF_OK;
+
+    s->nnodes = nnodes;
+
+    scratch_alloc(patch, sizeof(gf_node *) * nnodes, (void **)&s->nodes);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&s->npred);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&s->pending);
+    scratch_alloc(patch, sizeof(int) * (nnodes + 1), (void **)&s->succ_off);
+
+    for (n = 0; n < s->nthreads; n++) {
+        scratch_alloc(patch,
+                        sizeof(int) * nnodes,
+                        (void **)&s->workers[n].deque);
+    }
+
+    node = patch->nodes;
+    for (n = 0; n < nnodes; n++) {
+        s->nodes[n] = node;
+        node = node->next;
+    }
+
+    return graph_build(patch, s->nodes, nnodes,
+                       s->npred, s->succ_off, &s->succ);
+}
+
+static void worker_push(gf_worker *w, int id)
+{
+    pthread_mutex_lock(&w->lock);
+    w->deque[w->bottom++] = id;
+    pthread_mutex_unlock(&w->lock);
+}
+
+static int worker_pop(gf_worker *w)
+{
+    int id;
+    id = -1;
+    pthread_mutex_lock(&w->lock);
+    if (w->bottom > w->top) id = w->deque[--w->bottom];
+    pthread_mutex_unlock(&w->lock);
+    return id;
+}
+
+static int worker_steal(gf_worker *w)
+{
+    int id;
+    id = -1;
+    pthread_mutex_lock(&w->lock);
+    if (w->bottom > w->top) id = w->deque[w->top++];
+    pthread_mutex_unlock(&w->lock);
+    return id;
+}
+
+static void worker_run(gf_sched *s, int self)
+{
+    gf_worker *w;
+    int id;
+    int i;
+
+    w = &s->workers[self];
+
+    while (GF_ATOMIC_GET(&s->remaining) > 0) {
+        id = worker_pop(w);
+
+        for (i = 1; id < 0 && i < s->nthreads; i++) {
+            id = worker_steal(&s->workers[(self + i) % s->nthreads]);
+        }
+
+        if (id < 0) {
+            sched_yield();
+            continue;
+        }
+
+        gf_node_compute(s->nodes[id]);
+
+        for (i = s->succ_off[id]; i < s->succ_off[id + 1]; i++) {
+            if (GF_ATOMIC_DEC(&s->pending[s->succ[i]]) == 0) {
+                worker_push(w, s->succ[i]);
+            }
+        }
+
+        GF_ATOMIC_DEC(&s->remaining);
+    }
+}
+
+static void *worker_thread(void *ud)
+{
+    gf_worker *w;
+    gf_sched *s;
+    int self;
+    int round;
+
+    w = ud;
+    s = w->sched;
+    self = w - s->workers;
+
+    /* threads are created before the first block */
+    round = 0;
+
+    pthread_mutex_lock(&s->lock);
+
+    while (1) {
+        while (round == s->round && !s->quit) {
+            pthread_cond_wait(&s->start, &s->lock);
+        }
+        if (s->quit) break;
+        round = s->round;
+        pthread_mutex_unlock(&s->lock);
+
+        worker_run(s, self);
+
+        pthread_mutex_lock(&s->lock);
+        s->nidle++;
+        if (s->nidle == s->nthreads - 1) pthread_cond_signal(&s->done);
+    }
+
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+static int sched_compute(gf_sched *s)
+{
+    gf_patch *patch;
+    int n;
+    int w;
+
+    patch = s->patch;
+
+    if (s->built != patch->generation) {
+        sched_build_graph(s);
+    }
+
+    if (s->nnodes == 0) return GF_OK;
+
+    for (n = 0; n < s->nthreads; n++) {
+        s->workers[n].top = 0;
+        s->workers[n].bottom = 0;
+    }
+
+    w = 0;
+    for (n = 0; n < s->nnodes; n++) {
+        s->pending[n] = s->npred[n];
+        if (s->npred[n] == 0) {
+            gf_worker *wk;
+            wk = &s->workers[w];
+            wk->deque[wk->bottom++] = n;
+            w = (w + 1) % s->nthreads;
+        }
+    }
+
+    s->remaining = s->nnodes;
+
+    pthread_mutex_lock(&s->lock);
+    s->nidle = 0;
+    s->round++;
+    pthread_cond_broadcast(&s->start);
+    pthread_mutex_unlock(&s->lock);
+
+    worker_run(s, 0);
+
+    pthread_mutex_lock(&s->lock);
+    while (s->nidle < s->nthreads - 1) {
+        pthread_cond_wait(&s->done, &s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    return GF_OK;
+}
+
+static void sched_destroy(gf_sched *s)
+{
+    gf_patch *patch;
+    int n;
+
+    patch = s->patch;
+
+    pthread_mutex_lock(&s->lock);
+    s->quit = 1;
+    pthread_cond_broadcast(&s->start);
+    pthread_mutex_unlock(&s->lock);
+
+    for (n = 1; n < s->nthreads; n++) {
+        pthread_join(s->threads[n], NULL);
+    }
+
+    sched_free_graph(s);
+
+    for (n = 0; n < s->nthreads; n++) {
+        pthread_mutex_destroy(&s->workers[n].lock);
+    }
+
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->start);
+    pthread_cond_destroy(&s->done);
+
+    scratch_free(patch, (void **)&s->workers);
+    scratch_free(patch, (void **)&s->threads);
+    scratch_free(patch, (void **)&s);
+}
+
+int gf_patch_threads(gf_patch *patch, int nthreads)
+{
+    gf_sched *s;
+    int rc;
+    int n;
+
+    if (patch->sched != NULL) {
+        sched_destroy(patch->sched);
+        patch->sched = NULL;
+    }
+
+    if (nthreads <= 1) return GF_OK;
+
+    rc = scratch_alloc(patch, sizeof(gf_sched), (void **)&s);
+    GF_ERROR_CHECK(rc);
+
+    s->patch = patch;
+    s->nthreads = nthreads;
+    /* anything but the current generation */
+    s->built = patch->generation - 1;
+    s->nnodes = 0;
+    s->succ = NULL;
+    s->round = 0;
+    s->nidle = 0;
+    s->quit = 0;
+    s->remaining = 0;
+
+    scratch_alloc(patch, sizeof(gf_worker) * nthreads,
+                    (void **)&s->workers);
+    scratch_alloc(patch, sizeof(pthread_t) * nthreads,
+                    (void **)&s->threads);
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->start, NULL);
+    pthread_cond_init(&s->done, NULL);
+
+    for (n = 0; n < nthreads; n++) {
+        s->workers[n].sched = s;
+        s->workers[n].deque = NULL;
+        s->workers[n].top = 0;
+        s->workers[n].bottom = 0;
+        pthread_mutex_init(&s->workers[n].lock, NULL);
+    }
+
+    for (n = 1; n < nthreads; n++) {
+        pthread_create(&s->threads[n], NULL,
+                       worker_thread, &s->workers[n]);
+    }
+
+    patch->sched = s;
+
+    return GF_OK;
+}
+
+#else
+
+static int sched_compute(gf_sched *s)
+{
+    return GF_NOT_OK;
+}
+
+int gf_patch_threads(gf_patch *patch, int nthreads)
+{
+    if (nthreads <= 1) return GF_OK;
+    return GF_NOT_OK;
+}
+
+#endif
+
+/* Optimizer
+ *
+ * gf_patch_optimize does two things to the node list.
+ *
+ * First, nodes whose output never makes it anywhere are
+ * flagged with GF_NODE_DEAD, moved to the end of the list,
+ * and skipped when computing. The roots are nodes flagged
+ * as sinks (wavout and the other nodes that write to files),
+ * nodes flagged as serial, nodes without outputs, and the
+ * last nodes to write to buffers that are still on the
+ * stack or held. Anything a root reads from,
+ * directly or indirectly, stays. Reads of a buffer that
+ * happen before anything writes to it in the list get the
+ * value from the previous block, so they depend on the
+ * last writer.
+ *
+ * Second, the remaining nodes are put in a new order that
+ * follows the dependency graph depth-first, so a node tends
+ * to run right after the nodes it reads from, while their
+ * buffers are still in cache.
+ *
+ * This needs to be called again if nodes get added later.
+ * Each pass works from the order the nodes were created in
+ * (their ids), not the list left by the pass before, so the
+ * result doesn't depend on how many passes there were.
+ */
+
+static int node_has_output(gf_node *node)
+{
+    int c;
+    gf_cable *cab;
+
+    for (c = 0; c < node->ncables; c++) {
+        cab = &node->cables[c];
+        if (cab->pcable == cab && cab->type != CABLE_IVAL) return 1;
+    }
+
+    return 0;
+}
+
+static void graph_live(gf_patch *patch,
+                       gf_node **nodes, int nnodes,
+                       char *live)
+{
+    gf_node *node;
+    int ncables;
+    int n, c, i;
+    unsigned long tabsize;
+    struct graph_region *tab;
+    struct graph_region **wrap;
+    int *wrapnode;
+    int nwrap;
+    int *edges;
+    int nedges;
+    int *off;
+    int *deps;
+    int *stack;
+    int pos;
+    gf_buffer *buf;
+
+    ncables = 0;
+    for (n = 0; n < nnodes; n++) ncables += nodes[n]->ncables;
+
+    tabsize = 16;
+    while (tabsize < 2 * (unsigned long)(ncables + patch->pool.size + patch->stack.pos)) {
+        tabsize <<= 1;
+    }
+
+    tab = NULL;
+    wrap = NULL;
+    wrapnode = NULL;
+    edges = NULL;
+    off = NULL;
+    deps = NULL;
+    stack = NULL;
+
+    scratch_alloc(patch, sizeof(struct graph_region) * tabsize,
+                    (void **)&tab);
+    scratch_alloc(patch, sizeof(struct graph_region *) * (ncables + 1),
+                    (void **)&wrap);
+    scratch_alloc(patch, sizeof(int) * (ncables + 1), (void **)&wrapnode);
+    scratch_alloc(patch, sizeof(int) * 2 * (ncables + 1), (void **)&edges);
+    scratch_alloc(patch, sizeof(int) * (nnodes + 1), (void **)&off);
+    scratch_alloc(patch, sizeof(int) * (ncables + 1), (void **)&deps);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&stack);
+
+    memset(tab, 0, sizeof(struct graph_region) * tabsize);
+
+    /* read-after-write dependencies only */
+
+    nedges = 0;
+    nwrap = 0;
+
+    for (n = 0; n < nnodes; n++) {
+        node = nodes[n];
+        live[n] = 0;
+
+        for (c = 0; c < node->ncables; c++) {
+            gf_cable *cab;
+            struct graph_region *r;
+            int serial;
+
+            cab = &node->cables[c];
+            r = graph_lookup(tab, tabsize - 1, cab->val);
+            serial = node->flags & GF_NODE_SERIAL;
+
+            if (cab->pcable != cab || serial) {
+                if (r->writer >= 0) {
+                    if (r->writer != n) {
+                        edges[2*nedges] = r->writer;
+                        edges[2*nedges + 1] = n;
+                        nedges++;
+                    }
+                } else {
+                    wrap[nwrap] = r;
+                    wrapnode[nwrap] = n;
+                    nwrap++;
+                }
+            }
+
+            if (cab->pcable == cab || serial) r->writer = n;
+        }
+    }
+
+    for (i = 0; i < nwrap; i++) {
+        if (wrap[i]->writer >= 0 && wrap[i]->writer != wrapnode[i]) {
+            edges[2*nedges] = wrap[i]->writer;
+            edges[2*nedges + 1] = wrapnode[i];
+            nedges++;
+        }
+    }
+
+    /* predecessor lists, indexed by reader */
+
+    for (n = 0; n <= nnodes; n++) off[n] = 0;
+    for (i = 0; i < nedges; i++) off[edges[2*i + 1] + 1]++;
+    for (n = 0; n < nnodes; n++) off[n + 1] += off[n];
+    for (n = 0; n < nnodes; n++) stack[n] = off[n];
+    for (i = 0; i < nedges; i++) {
+        deps[stack[edges[2*i + 1]]++] = edges[2*i];
+    }
+
+    /* roots */
+
+    pos = 0;
+
+    for (n = 0; n < nnodes; n++) {
+        node = nodes[n];
+        if ((node->flags & (GF_NODE_SERIAL | GF_NODE_SINK)) ||
+            !node_has_output(node)) {
+            live[n] = 1;
+            stack[pos++] = n;
+        }
+    }
+
+    for (i = 0; i < patch->stack.pos + patch->pool.size; i++) {
+        struct graph_region *r;
+
+        if (i < patch->stack.pos) {
+            buf = patch->stack.buffers[i];
+        } else {
+            buf = &patch->pool.buffers[i - patch->stack.pos];
+            if (buf->list != BUFLIST_HELD) continue;
+        }
+
+        r = graph_lookup(tab, tabsize - 1, buf->buf);
+        if (r->writer >= 0 && !live[r->writer]) {
+            live[r->writer] = 1;
+            stack[pos++] = r->writer;
+        }
+    }
+
+    /* everything the roots read from */
+
+    while (pos > 0) {
+        n = stack[--pos];
+        for (i = off[n]; i < off[n + 1]; i++) {
+            if (!live[deps[i]]) {
+                live[deps[i]] = 1;
+                stack[pos++] = deps[i];
+            }
+        }
+    }
+
+    scratch_free(patch, (void **)&tab);
+    scratch_free(patch, (void **)&wrap);
+    scratch_free(patch, (void **)&wrapnode);
+    scratch_free(patch, (void **)&edges);
+    scratch_free(patch, (void **)&off);
+    scratch_free(patch, (void **)&deps);
+    scratch_free(patch, (void **)&stack);
+}
+
+static void optimize_append(gf_patch *patch, gf_node *node)
+{
+    if (patch->last == NULL) patch->nodes = node;
+    else patch->last->next = node;
+    patch->last = node;
+}
+
+int gf_patch_optimize(gf_patch *patch)
+{
+    int nnodes;
+    int nlive;
+    int n, i;
+    gf_node *node;
+    gf_node **nodes;
+    gf_node **lnodes;
+    int *order;
+    char *live;
+    int *npred;
+    int *succ_off;
+    int *succ;
+    int *stack;
+    int pos;
+    int norder;
+    int nmoved;
+
+    nnodes = patch->nnodes;
+    if (nnodes <= 0) return GF_OK;
+
+    nodes = NULL;
+    lnodes = NULL;
+    order = NULL;
+    live = NULL;
+    npred = NULL;
+    succ_off = NULL;
+    stack = NULL;
+
+    scratch_alloc(patch, sizeof(gf_node *) * nnodes, (void **)&nodes);
+    scratch_alloc(patch, sizeof(gf_node *) * nnodes, (void **)&lnodes);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&order);
+    scratch_alloc(patch, nnodes, (void **)&live);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&npred);
+    scratch_alloc(patch, sizeof(int) * (nnodes + 1), (void **)&succ_off);
+    scratch_alloc(patch, sizeof(int) * nnodes, (void **)&stack);
+
+    /* analyze in creation order: an earlier pass has moved
+     * dead nodes to the end, where they would look like the
+     * last writers of buffers that were reused */
+
+    node = patch->nodes;
+    for (n = 0; n < nnodes; n++) {
+        nodes[node->id] = node;
+        node->flags &= ~GF_NODE_DEAD;
+        node = node->next;
+    }
+
+    graph_live(patch, nodes, nnodes, live);
+
+    nlive = 0;
+    for (n = 0; n < nnodes; n++) {
+        if (live[n]) {
+            lnodes[nlive++] = nodes[n];
+        }
+    }
+
+    /* depth-first topological order: successors that become
+     * ready go on top of the stack, so consumers follow
+     * their producers. Ties keep the original order. */
+
+    graph_build(patch, lnodes, nlive, npred, succ_off, &succ);
+
+    pos = 0;
+    for (n = nlive - 1; n >= 0; n--) {
+        if (npred[n] == 0) stack[pos++] = n;
+    }
+
+    norder = 0;
+    while (pos > 0) {
+        n = stack[--pos];
+        order[norder++] = n;
+        for (i = succ_off[n + 1] - 1; i >= succ_off[n]; i--) {
+            if (--npred[succ[i]] == 0) stack[pos++] = succ[i];
+        }
+    }
+
+    if (succ != NULL) scratch_free(patch, (void **)&succ);
+
+    /* relink: live nodes in their new order, then dead ones */
+
+    nmoved = 0;
+    patch->nodes = NULL;
+    patch->last = NULL;
+
+    for (i = 0; i < nlive; i++) {
+        node = lnodes[order[i]];
+        /* positions are among the nodes that are left */
+        if (order[i] != i) {
+            gf_print(patch, "optimize: moved node %d (%d -> %d)\n",
+                     node->id, order[i], i);
+            nmoved++;
+        }
+        optimize_append(patch, node);
+    }
+
+    for (n = 0; n < nnodes; n++) {
+        if (live[n]) continue;
+        node = nodes[n];
+        node->flags |= GF_NODE_DEAD;
+        gf_print(patch, "optimize: removed node %d\n", node->id);
+        optimize_append(patch, node);
+    }
+
+    patch->last->next = NULL;
+
+    gf_print(patch,
+             "optimize: %d nodes, %d removed, %d moved\n",
+             nnodes, nnodes - nlive, nmoved);
+
+    patch->generation++;
+
+    scratch_free(patch, (void **)&nodes);
+    scratch_free(patch, (void **)&lnodes);
+    scratch_free(patch, (void **)&order);
+    scratch_free(patch, (void **)&live);
+    scratch_free(patch, (void **)&npred);
+    scratch_free(patch, (void **)&succ_off);
+    scratch_free(patch, (void **)&stack);
+
+    return GF_OK;
+}
+
+void gf_print(gf_patch *p, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    p->print(p, fmt, args);
+    va_end(args);
+}
+
+static void gf_print_default(gf_patch *p, const char *str, va_list args)
+{
+    vprintf(str, args);
+}
+
+void gf_print_init(gf_patch *p)
+{
+    p->print = gf_print_default;
+}
+
+void gf_print_set(gf_patch *p,
+		  void (*print)(gf_patch *, const char *, va_list))
+{
+    p->print = print;
+}
+
+void gf_subpatch_init(gf_subpatch *subpatch)
+{
+    subpatch->nodes = NULL;
+    subpatch->last = NULL;
+    subpatch->out = NULL;
+    subpatch->nnodes = 0;
+    gf_pointerlist_init(&subpatch->plist);
+}
+
+void gf_subpatch_save(gf_patch *patch, gf_subpatch *subpatch)
 {
     subpatch->nodes = patch->nodes;
     subpatch->last = patch->last;
@@ -1233,6 +2767,57 @@ void gf_subpatch_restore(gf_patch *patch, gf_subpatch *subpatch)
     patch->last = subpatch->last;
     patch->nnodes = subpatch->nnodes;
     patch->plist = subpatch->plist;
+    patch->generation++;
+}
+
+/* Building a subpatch in place
+ *
+ * Nodes made between gf_subpatch_begin and gf_subpatch_end
+ * get cut out of the patch and moved into the subpatch.
+ * Unlike clearing the patch, node ids keep counting up, so
+ * the new nodes can still connect to cables made before
+ * them. Anything added to the pointer list stays with the
+ * patch.
+ */
+
+void gf_subpatch_begin(gf_patch *patch, gf_subpatch *subpatch)
+{
+    /* remember where the cut starts */
+    subpatch->nodes = NULL;
+    subpatch->last = patch->last;
+    subpatch->nnodes = patch->nnodes;
+}
+
+void gf_subpatch_end(gf_patch *patch, gf_subpatch *subpatch)
+{
+    gf_node *start;
+    int nstart;
+
+    start = subpatch->last;
+    nstart = subpatch->nnodes;
+
+    subpatch->nnodes = patch->nnodes - nstart;
+
+    if (subpatch->nnodes <= 0) {
+        subpatch->nnodes = 0;
+        subpatch->nodes = NULL;
+        subpatch->last = NULL;
+        return;
+    }
+
+    if (start == NULL) subpatch->nodes = patch->nodes;
+    else subpatch->nodes = gf_node_get_next(start);
+
+    subpatch->last = patch->last;
+    gf_node_set_next(subpatch->last, NULL);
+
+    if (start == NULL) patch->nodes = NULL;
+    else gf_node_set_next(start, NULL);
+
+    patch->last = start;
+    patch->prevlast = NULL;
+    patch->nnodes = nstart;
+    patch->generation++;
 }
 
 void gf_subpatch_compute(gf_subpatch *subpatch)
@@ -1248,6 +2833,16 @@ void gf_subpatch_compute(gf_subpatch *subpatch)
     }
 }
 
+gf_cable *gf_subpatch_out(gf_subpatch *subpatch)
+{
+    return subpatch->out;
+}
+
+void gf_subpatch_set_out(gf_subpatch *subpatch, gf_cable *out)
+{
+    subpatch->out = out;
+}
+
 void gf_subpatch_destroy(gf_subpatch *subpatch)
 {
     int n;
@@ -1269,7 +2864,7 @@ void gf_subpatch_free(gf_subpatch *subpatch)
     node = subpatch->nodes;
     for (n = 0; n < subpatch->nnodes; n++) {
         next = gf_node_get_next(node);
-        free(node);
+        gf_memory_free(node->patch, (void **) &node);
         node = next;
     }
     subpatch->nnodes = 0;
@@ -1281,6 +2876,8 @@ int gf_memory_alloc(gf_patch *p, size_t size, void **ud)
 {
     void *ptr;
 
+    if (p != NULL) return p->malloc(p, size, ud);
+
     ptr = malloc(size);
 
     if (ptr == NULL)
@@ -1292,6 +2889,7 @@ int gf_memory_alloc(gf_patch *p, size_t size, void **ud)
 
 int gf_memory_free(gf_patch *p, void **ud)
 {
+    if (p != NULL) return p->free(p, ud);
     free(*ud);
     return GF_OK;
 }
@@ -1325,3 +2923,315 @@ void gf_memory_defaults(gf_patch *p)
 {
     gf_memory_override(p, default_malloc, default_free);
 }
+
+/* Arena
+ *
+ * A bump allocator for everything a patch allocates while
+ * it is being built. Nodes, their cables and their state
+ * end up next to each other in the order they were created,
+ * which is also the order they get computed in.
+ *
+ * Freeing arena memory does nothing: it all goes away in one
+ * go when the patch is destroyed, so nothing allocated from
+ * the patch can be freed after that. Memory allocated before
+ * the arena was set up is still freed normally, with the
+ * allocator the patch had before.
+ *
+ * Memory that gets freed again while the patch is running,
+ * like the scheduler's graph and the optimizer's work
+ * arrays, is scratch memory. It skips the arena, or every
+ * rebuild would use up more of it.
+ */
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(x) (((x) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+typedef struct gf_arenablk gf_arenablk;
+
+struct gf_arenablk {
+    gf_arenablk *next;
+    unsigned char *data;
+    size_t size;
+    size_t pos;
+};
+
+struct gf_arena {
+    gf_arenablk *blks;
+    size_t blksize;
+    gf_mallocfun malloc;
+    gf_freefun free;
+};
+
+static gf_arenablk *arena_newblk(gf_arena *a, size_t size)
+{
+    gf_arenablk *blk;
+    size_t hdr;
+
+    hdr = ARENA_ROUND(sizeof(gf_arenablk));
+    blk = malloc(hdr + size + ARENA_ALIGN);
+    if (blk == NULL) return NULL;
+
+    /* malloc only guarantees alignment for the basic types */
+    blk->data = (unsigned char *)blk + hdr;
+    blk->data += (ARENA_ALIGN - ((size_t)blk->data % ARENA_ALIGN)) % ARENA_ALIGN;
+    blk->size = size;
+    blk->pos = 0;
+    blk->next = a->blks;
+    a->blks = blk;
+    return blk;
+}
+
+static int arena_malloc(gf_patch *p, size_t size, void **ud)
+{
+    gf_arena *a;
+    gf_arenablk *blk;
+
+    a = p->arena;
+    size = ARENA_ROUND(size);
+    blk = a->blks;
+
+    if (blk == NULL || blk->pos + size > blk->size) {
+        if (size > a->blksize / 4) {
+            /* big allocations get a block to themselves,
+             * placed behind the current one */
+            gf_arenablk *cur;
+            cur = a->blks;
+            if (cur != NULL) a->blks = cur->next;
+            blk = arena_newblk(a, size);
+            if (cur != NULL) {
+                cur->next = a->blks;
+                a->blks = cur;
+            }
+        } else {
+            blk = arena_newblk(a, a->blksize);
+        }
+        if (blk == NULL) return GF_NOT_OK;
+    }
+
+    *ud = blk->data + blk->pos;
+    blk->pos += size;
+    return GF_OK;
+}
+
+static int arena_free(gf_patch *p, void **ud)
+{
+    gf_arenablk *blk;
+    unsigned char *ptr;
+
+    ptr = *ud;
+
+    for (blk = p->arena->blks; blk != NULL; blk = blk->next) {
+        if (ptr >= blk->data && ptr < blk->data + blk->size) {
+            return GF_OK;
+        }
+    }
+
+    return p->arena->free(p, ud);
+}
+
+static int scratch_alloc(gf_patch *p, size_t size, void **ud)
+{
+    if (p->arena != NULL) return p->arena->malloc(p, size, ud);
+    return gf_memory_alloc(p, size, ud);
+}
+
+static int scratch_free(gf_patch *p, void **ud)
+{
+    if (p->arena != NULL) return p->arena->free(p, ud);
+    return gf_memory_free(p, ud);
+}
+
+static void arena_release(gf_patch *patch)
+{
+    gf_arena *a;
+    gf_arenablk *blk, *next;
+
+    a = patch->arena;
+    if (a == NULL) return;
+
+    blk = a->blks;
+    while (blk != NULL) {
+        next = blk->next;
+        free(blk);
+        blk = next;
+    }
+
+    gf_memory_override(patch, a->malloc, a->free);
+    free(a);
+    patch->arena = NULL;
+}
+
+int gf_patch_arena(gf_patch *patch, size_t blksize)
+{
+    gf_arena *a;
+
+    if (patch->arena != NULL) return GF_ALREADY_ALLOCATED;
+    if (blksize == 0) blksize = 65536;
+
+    a = malloc(sizeof(gf_arena));
+    if (a == NULL) return GF_NOT_OK;
+    a->blks = NULL;
+    a->blksize = ARENA_ROUND(blksize);
+    a->malloc = patch->malloc;
+    a->free = patch->free;
+    patch->arena = a;
+    gf_memory_override(patch, arena_malloc, arena_free);
+    return GF_OK;
+}
+
+/* Profiling
+ *
+ * When graforge is built with GF_PROFILE, gf_patch_profile
+ * turns on timing of each node's compute function. Each
+ * block's time goes into a histogram with 4 buckets per
+ * octave of nanoseconds, which is enough to estimate p99
+ * to within about 20% without storing every block.
+ *
+ * Nodes are tagged with the name set by gf_patch_tag at the
+ * time they were made, usually the command that made them.
+ * This is what tells them apart in the profile: the node
+ * type set with gf_node_set_type is left out, since only a
+ * few nodes that need to be found again set one.
+ *
+ * Without GF_PROFILE none of this is compiled in, and the
+ * functions below return GF_NOT_OK.
+ */
+
+void gf_patch_tag(gf_patch *patch, const char *tag)
+{
+    patch->tag = tag;
+}
+
+#ifdef GF_PROFILE
+static void prof_reset(gf_prof *prof)
+{
+    int b;
+
+    prof->nblocks = 0;
+    prof->total = 0;
+    for (b = 0; b < PROF_NBUCKETS; b++) prof->hist[b] = 0;
+}
+
+static void prof_init(gf_node *node, const char *tag)
+{
+    node->tag[0] = '\0';
+    if (tag != NULL) {
+        strncpy(node->tag, tag, PROF_TAGSIZE - 1);
+        node->tag[PROF_TAGSIZE - 1] = '\0';
+    }
+    prof_reset(&node->prof);
+}
+
+static int prof_bucket(unsigned long ns)
+{
+    int msb;
+    int b;
+
+    if (ns < 4) return ns;
+
+    msb = 0;
+    while ((ns >> msb) > 1) msb++;
+
+    /* top two bits below the msb pick the quarter octave */
+    b = msb * 4 + ((ns >> (msb - 2)) & 3);
+    if (b >= PROF_NBUCKETS) b = PROF_NBUCKETS - 1;
+
+    return b;
+}
+
+static double prof_bucket_max(int b)
+{
+    if (b < 8) return b;
+    return (double)(5 + (b & 3)) * (1UL << (b / 4 - 2));
+}
+
+static void prof_compute(gf_node *node)
+{
+    struct timespec t0, t1;
+    unsigned long ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    node->compute(node);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    ns = (t1.tv_sec - t0.tv_sec) * 1000000000L +
+        (t1.tv_nsec - t0.tv_nsec);
+
+    node->prof.nblocks++;
+    node->prof.total += ns;
+    node->prof.hist[prof_bucket(ns)]++;
+}
+
+static double prof_p99(gf_prof *prof)
+{
+    unsigned long count;
+    unsigned long target;
+    int b;
+
+    /* smallest bucket that covers 99% of blocks */
+    target = prof->nblocks - prof->nblocks / 100;
+    count = 0;
+
+    for (b = 0; b < PROF_NBUCKETS; b++) {
+        count += prof->hist[b];
+        if (count >= target) return prof_bucket_max(b);
+    }
+
+    return 0;
+}
+#endif
+
+int gf_patch_profile(gf_patch *patch, int on)
+{
+#ifdef GF_PROFILE
+    gf_node *node;
+    int n;
+
+    /* starting over clears the old numbers */
+    if (on && !patch->profile) {
+        node = patch->nodes;
+        for (n = 0; n < patch->nnodes; n++) {
+            prof_reset(&node->prof);
+            node = node->next;
+        }
+    }
+
+    patch->profile = on;
+    return GF_OK;
+#else
+    return GF_NOT_OK;
+#endif
+}
+
+int gf_patch_profdump(gf_patch *patch, FILE *fp)
+{
+#ifdef GF_PROFILE
+    gf_node *node;
+    gf_prof *prof;
+    int n;
+    double mean;
+
+    fprintf(fp, "id,cmd,blocks,total_ns,mean_ns,p99_ns\n");
+
+    node = patch->nodes;
+    for (n = 0; n < patch->nnodes; n++) {
+        prof = &node->prof;
+        mean = 0;
+        if (prof->nblocks > 0) mean = prof->total / prof->nblocks;
+        fprintf(fp, "%d,%s,%lu,%.0f,%.1f,%.0f\n",
+                node->id,
+                node->tag,
+                prof->nblocks,
+                prof->total,
+                mean,
+                prof_p99(prof));
+        node = node->next;
+    }
+
+    return GF_OK;
+#else
+    (void)patch;
+    (void)fp;
+    return GF_NOT_OK;
+#endif
+}
@@ -23,6 +23,13 @@ enum {
     GF_STACK_OVERFLOW
 };
 
+enum {
+    GF_NODE_SERIAL = 1,
+    GF_NODE_SINK = 2,
+    GF_NODE_DEAD = 4,
+    GF_NODE_STATELESS = 8
+};
+
 
 typedef struct gf_node gf_node;
 typedef struct gf_pointer gf_pointer;
@@ -34,6 +41,8 @@ typedef struct gf_buffer gf_buffer;
 typedef struct gf_bufferpool gf_bufferpool;
 typedef struct gf_stack gf_stack;
 typedef struct gf_patch gf_patch;
+typedef struct gf_sched gf_sched;
+typedef struct gf_arena gf_arena;
 typedef int(*gf_mallocfun)(gf_patch*,size_t,void**);
 typedef int(*gf_freefun)(gf_patch*,void**);
 
@@ -60,10 +69,30 @@ struct gf_cable {
     GFFLT*blk;
     int blksize;
     unsigned char type;
+    unsigned char silent;
     gf_cable*pcable;
     gf_buffer*buf;
 };
 
+typedef struct {
+    GFFLT *ptr;
+    int stride;
+} gf_view;
+
+/* stride is 0 for constants, 1 for blocks */
+#define GF_VIEW(v, n) ((v).ptr[(n) * (v).stride])
+#define GF_VIEW_CONSTANT(v) ((v).stride == 0)
+
+#ifndef GF_TAIL_THRESH
+#define GF_TAIL_THRESH 1e-5
+#endif
+
+typedef struct {
+    int hold;
+    int count;
+    int quiet;
+} gf_tail;
+
 size_t gf_node_size(void);
 void gf_node_init(gf_node*node,int blksize);
 int gf_node_get_id(gf_node*node);
@@ -85,6 +114,8 @@ int gf_node_set_block(gf_node*node,int id);
 int gf_node_get_ncables(gf_node*node);
 int gf_node_get_type(gf_node*node);
 void gf_node_set_type(gf_node*node,int type);
+int gf_node_get_flags(gf_node*node);
+void gf_node_set_flags(gf_node*node,int flags);
 void gf_node_set_patch(gf_node*node,gf_patch*patch);
 int gf_node_get_patch(gf_node*node,gf_patch**patch);
 gf_node*gf_node_get_next(gf_node*node);
@@ -97,12 +128,23 @@ void gf_cable_set_constant(gf_cable*cable,GFFLT val);
 void gf_cable_set_value(gf_cable*c,GFFLT val);
 GFFLT gf_cable_get(gf_cable*cable,int pos);
 void gf_cable_set(gf_cable*cable,int pos,GFFLT val);
+GFFLT*gf_cable_data(gf_cable*cable);
+GFFLT*gf_cable_input(gf_cable*cable,GFFLT*tmp,int blksize);
+void gf_cable_view(gf_cable*cable,gf_view*view);
+int gf_cable_silent(gf_cable*cable);
+void gf_cable_silent_set(gf_cable*cable,int silent);
+void gf_cable_silence(gf_cable*cable);
+int gf_cable_silent_update(gf_cable*cable);
 int gf_cable_connect(gf_cable*c1,gf_cable*c2);
 void gf_cable_connect_nocheck(gf_cable*c1,gf_cable*c2);
 int gf_cable_pop(gf_cable*cab);
 void gf_cable_push(gf_cable*cab);
 int gf_cable_is_block(gf_cable*cab);
 int gf_cable_is_constant(gf_cable*cab);
+int gf_cable_is_krate(gf_cable*cab);
+int gf_node_set_krate(gf_node*node,int id);
+void gf_cable_kset(gf_cable*cable,GFFLT val);
+GFFLT gf_cable_kget(gf_cable*cable);
 gf_buffer*gf_cable_get_buffer(gf_cable*cab);
 void gf_cable_set_buffer(gf_cable*cab,gf_buffer*buf);
 int gf_cable_make_block(gf_cable*cable,gf_stack*stack,int blksize);
@@ -112,6 +154,11 @@ int gf_cable_blksize(gf_cable*cable);
 void gf_cable_override(gf_cable*c1,gf_cable*c2);
 void gf_cable_copy(gf_cable*c1,gf_cable*c2);
 
+void gf_tail_init(gf_tail*t,int hold);
+void gf_tail_hold(gf_tail*t,int hold);
+int gf_tail_skip(gf_tail*t,int silent,int blksize);
+void gf_tail_check(gf_tail*t,GFFLT*out,int blksize);
+
 const char*gf_error(int rc);
 
 #define GF_ERROR_CHECK(rc) if(rc != GF_OK) return rc
@@ -151,6 +198,7 @@ gf_bufferpool*pool,int nbuf,int blksize);
 void gf_bufferpool_reset(gf_bufferpool*pool);
 void gf_bufferpool_destroy(gf_patch*patch,gf_bufferpool*pool);
 int gf_bufferpool_nactive(gf_bufferpool*pool);
+int gf_bufferpool_peak(gf_bufferpool*pool);
 int gf_bufferpool_unhold(gf_bufferpool*pool,gf_buffer*buf);
 int gf_bufferpool_nextfree(gf_bufferpool*pool,gf_buffer**buf);
 int gf_bufferpool_holdu(gf_bufferpool*pool,gf_buffer*buf);
@@ -171,6 +219,7 @@ int gf_stack_swap(gf_stack*stack);
 int gf_stack_hold(gf_stack*stack,gf_buffer**buf);
 int gf_stack_size(gf_stack*stack);
 int gf_stack_pos(gf_stack*stack);
+int gf_stack_peak(gf_stack*stack);
 void gf_stack_reset(gf_stack*stack);
 
 void gf_patch_init(gf_patch*patch,int blksize);
@@ -185,6 +234,7 @@ void gf_patch_free_nodes(gf_patch*patch);
 void gf_patch_setup(gf_patch*patch);
 void gf_patch_destroy(gf_patch*patch);
 void gf_patch_compute(gf_patch*patch);
+void gf_patch_compute_sub(gf_patch*patch,int pos,int len);
 void gf_patch_set_out(gf_patch*patch,gf_cable*cable);
 gf_cable*gf_patch_get_out(gf_patch*patch);
 size_t gf_patch_size(void);
@@ -197,6 +247,10 @@ int gf_patch_append_userdata(gf_patch*patch,
 gf_stack*gf_patch_stack(gf_patch*patch);
 int gf_patch_blksize(gf_patch*patch);
 int gf_patch_blksize_set(gf_patch *patch, int blksize);
+int gf_patch_klerp(gf_patch*patch);
+void gf_patch_klerp_set(gf_patch*patch,int klerp);
+int gf_patch_maxblksize(gf_patch*patch);
+int gf_patch_maxblksize_set(gf_patch*patch,int blksize);
 gf_bufferpool*gf_patch_pool(gf_patch*patch);
 void gf_patch_srate_set(gf_patch*patch,int sr);
 int gf_patch_srate_get(gf_patch*patch);
@@ -208,14 +262,25 @@ int gf_patch_bhold(gf_patch*patch,gf_buffer**b);
 int gf_patch_bunhold(gf_patch*patch,gf_buffer*b);
 void gf_patch_err(gf_patch*patch,int rc);
 gf_node*gf_patch_last_node(gf_patch*patch);
+int gf_patch_remove_last_node(gf_patch*patch);
+int gf_patch_fold_node(gf_patch*patch,gf_node*node,GFFLT*val);
+int gf_patch_threads(gf_patch*patch,int nthreads);
+int gf_patch_optimize(gf_patch*patch);
+int gf_patch_arena(gf_patch*patch,size_t blksize);
+void gf_patch_tag(gf_patch*patch,const char*tag);
+int gf_patch_profile(gf_patch*patch,int on);
+int gf_patch_profdump(gf_patch*patch,FILE*fp);
 
 void gf_subpatch_init(gf_subpatch*subpatch);
 void gf_subpatch_save(gf_patch*patch,gf_subpatch*subpatch);
 void gf_subpatch_restore(gf_patch*patch,gf_subpatch*subpatch);
+void gf_subpatch_begin(gf_patch*patch,gf_subpatch*subpatch);
+void gf_subpatch_end(gf_patch*patch,gf_subpatch*subpatch);
 void gf_subpatch_compute(gf_subpatch*subpatch);
 void gf_subpatch_destroy(gf_subpatch*subpatch);
 void gf_subpatch_free(gf_subpatch*subpatch);
 gf_cable*gf_subpatch_out(gf_subpatch*subpatch);
+void gf_subpatch_set_out(gf_subpatch*subpatch,gf_cable*out);
 
 int gf_memory_alloc(gf_patch*p,size_t size,void**ud);
 int gf_memory_free(gf_patch*p,void**ud);
@@ -231,6 +296,8 @@ void gf_print_set(gf_patch*p,void(*print)(gf_patch*,const char*,va_list));
 #pragma incomplete gf_node
 #pragma incomplete gf_pointer
 #pragma incomplete gf_stack
+#pragma incomplete gf_sched
+#pragma incomplete gf_arena
 #endif
 
 #endif
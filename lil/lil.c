@@ -51,7 +51,7 @@
 #define ERROR_DEFAULT 1
 #define ERROR_FIXHEAD 2
 
-#define CALLBACKS 8
+#define CALLBACKS 9
 #define MAX_CATCHER_DEPTH 16384
 #define HASHMAP_CELLS 256
 #define HASHMAP_CELLMASK 0xFF
@@ -146,6 +146,8 @@ struct _lil_t
     void* data;
     char* embed;
     size_t embedlen;
+    int running;
+    int errcode;
 };
 
 typedef struct _expreval_t
@@ -732,6 +734,7 @@ lil_t lil_new(void)
     lil->empty = alloc_value(NULL);
     lil->dollarprefix = strclone("set ");
     hm_init(&lil->cmdmap);
+    lil->running = 1;
     register_stdcmds(lil);
     return lil;
 }
@@ -1011,6 +1014,10 @@ lil_value_t lil_parse(lil_t lil, const char* code, size_t codelen, int funclevel
             if (cmd) {
                 if (cmd->proc) {
                     size_t shead = lil->head;
+                    if (lil->callback[LIL_CALLBACK_CALL]) {
+                        lil_call_callback_proc_t proc = (lil_call_callback_proc_t)lil->callback[LIL_CALLBACK_CALL];
+                        proc(lil, cmd->name);
+                    }
                     val = cmd->proc(lil, words->c - 1, words->v + 1);
                     if (lil->error == ERROR_FIXHEAD) {
                         lil->error = ERROR_DEFAULT;
@@ -1072,9 +1079,13 @@ LILAPI lil_value_t lil_call(lil_t lil, const char* funcname, size_t argc, lil_va
     lil_func_t cmd = find_cmd(lil, funcname);
     lil_value_t r = NULL;
     if (cmd) {
-        if (cmd->proc)
+        if (cmd->proc) {
+            if (lil->callback[LIL_CALLBACK_CALL]) {
+                lil_call_callback_proc_t proc = (lil_call_callback_proc_t)lil->callback[LIL_CALLBACK_CALL];
+                proc(lil, cmd->name);
+            }
             r = cmd->proc(lil, argc, argv);
-        else {
+        } else {
             size_t i;
             lil_push_env(lil);
             lil->env->func = cmd;
@@ -3540,3 +3551,23 @@ const char *lil_cmd_name(lil_func_t cmd)
 {
     return cmd->name;
 }
+
+void lil_set_errcode(lil_t lil, int err)
+{
+    lil->errcode = err;
+}
+
+int lil_get_errcode(lil_t lil)
+{
+    return lil->errcode;
+}
+
+void lil_set_running(lil_t lil, int running)
+{
+    lil->running = running;
+}
+
+int lil_get_running(lil_t lil)
+{
+    return lil->running;
+}
@@ -39,6 +39,7 @@
 #define LIL_CALLBACK_ERROR 5
 #define LIL_CALLBACK_SETVAR 6
 #define LIL_CALLBACK_GETVAR 7
+#define LIL_CALLBACK_CALL 8
 
 #define LIL_EMBED_NOFLAGS 0x0000
 
@@ -94,6 +95,7 @@ typedef LILCALLBACK void (*lil_store_callback_proc_t)(lil_t lil, const char* nam
 typedef LILCALLBACK void (*lil_error_callback_proc_t)(lil_t lil, size_t pos, const char* msg);
 typedef LILCALLBACK int (*lil_setvar_callback_proc_t)(lil_t lil, const char* name, lil_value_t* value);
 typedef LILCALLBACK int (*lil_getvar_callback_proc_t)(lil_t lil, const char* name, lil_value_t* value);
+typedef LILCALLBACK void (*lil_call_callback_proc_t)(lil_t lil, const char* name);
 typedef LILCALLBACK void (*lil_callback_proc_t)(void);
 
 LILAPI lil_t lil_new(void);
@@ -164,4 +166,15 @@ LILAPI int lil_main(int argc, char *argv[],
                     void (*loader)(lil_t),
                     void (*clean)(lil_t));
 
+/* exit state is kept per interpreter, so that several
+ * can run at once in one process */
+LILAPI void lil_set_errcode(lil_t lil, int err);
+LILAPI int lil_get_errcode(lil_t lil);
+LILAPI void lil_set_running(lil_t lil, int running);
+LILAPI int lil_get_running(lil_t lil);
+
+/* runs a script file, with argv set to the remaining args */
+LILAPI int lil_run(lil_t lil, const char *filename,
+                   int argc, char *argv[]);
+
 #endif
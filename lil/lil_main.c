@@ -37,13 +37,10 @@
 #include <time.h>
 #include "lil.h"
 
-static int running = 1;
-static int exit_code = 0;
-
 static LILCALLBACK void do_exit(lil_t lil, lil_value_t val)
 {
-    running = 0;
-    exit_code = (int)lil_to_integer(val);
+    lil_set_running(lil, 0);
+    lil_set_errcode(lil, (int)lil_to_integer(val));
 }
 
 static char* do_system(size_t argc, char** argv)
@@ -156,6 +153,7 @@ static LILCALLBACK lil_value_t fnc_readline(lil_t lil, size_t argc, lil_value_t*
 static int repl(void (*loader)(lil_t), void (*clean)(lil_t))
 {
     char buffer[16384];
+    int rc;
     lil_t lil = lil_new();
     lil_register(lil, "writechar", fnc_writechar);
     lil_register(lil, "system", fnc_system);
@@ -164,7 +162,7 @@ static int repl(void (*loader)(lil_t), void (*clean)(lil_t))
     if (loader != NULL) loader(lil);
     printf("Little Interpreted Language Interactive Shell\n");
     lil_callback(lil, LIL_CALLBACK_EXIT, (lil_callback_proc_t)do_exit);
-    while (running) {
+    while (lil_get_running(lil)) {
         lil_value_t result;
         const char* strres;
         const char* err_msg;
@@ -181,9 +179,10 @@ static int repl(void (*loader)(lil_t), void (*clean)(lil_t))
             printf("error at %i: %s\n", (int)pos, err_msg);
         }
     }
+    rc = lil_get_errcode(lil);
     if (clean != NULL) clean(lil);
     lil_free(lil);
-    return exit_code;
+    return rc;
 }
 
 /* Paul: added loader callback */
@@ -193,13 +192,7 @@ static int nonint(int argc,
                   void (*clean)(lil_t))
 {
     lil_t lil = lil_new();
-    const char* filename = argv[1];
-    const char* err_msg;
-    size_t pos;
-    lil_list_t arglist = lil_alloc_list();
-    lil_value_t args, result;
-    char* tmpcode;
-    int i;
+    int rc;
     lil_register(lil, "writechar", fnc_writechar);
     lil_register(lil, "system", fnc_system);
     lil_register(lil, "canread", fnc_canread);
@@ -207,7 +200,23 @@ static int nonint(int argc,
 
     if (loader != NULL) loader(lil);
 
-    for (i=2; i<argc; i++) {
+    rc = lil_run(lil, argv[1], argc - 2, argv + 2);
+
+    if (clean != NULL) clean(lil);
+    lil_free(lil);
+    return rc;
+}
+
+int lil_run(lil_t lil, const char *filename, int argc, char *argv[])
+{
+    const char* err_msg;
+    size_t pos;
+    lil_list_t arglist = lil_alloc_list();
+    lil_value_t args, result;
+    char* tmpcode;
+    int i;
+
+    for (i=0; i<argc; i++) {
         lil_list_append(arglist, lil_alloc_string(argv[i]));
     }
     args = lil_list_to_value(arglist, 1);
@@ -222,9 +231,7 @@ static int nonint(int argc,
     if (lil_error(lil, &err_msg, &pos)) {
         fprintf(stderr, "lil: error at %i: %s\n", (int)pos, err_msg);
     }
-    if (clean != NULL) clean(lil);
-    lil_free(lil);
-    return exit_code;
+    return lil_get_errcode(lil);
 }
 
 /* Paul: changed main to lil_main, also added callbacks */
@@ -235,8 +242,3 @@ int lil_main(int argc, char* argv[],
     if (argc < 2) return repl(loader, clean);
     else return nonint(argc, argv, loader, clean);
 }
-
-void lil_set_errcode(int err)
-{
-    exit_code = err;
-}
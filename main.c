@@ -1,14 +1,24 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "lil/lil.h"
 
 void sklil_loader_withextra(lil_t lil);
 void sklil_clean(lil_t lil);
+int sklil_batch_main(int argc, char *argv[],
+                     void (*loader)(lil_t),
+                     void (*clean)(lil_t));
 int lil_main(int argc, char *argv[],
              void (*loader)(lil_t),
              void (*clean)(lil_t));
 
 int main(int argc, char *argv[])
 {
+    if (argc > 1 && !strcmp(argv[1], "-batch")) {
+        return sklil_batch_main(argc - 1, argv + 1,
+                                sklil_loader_withextra,
+                                sklil_clean);
+    }
+
     return lil_main(argc, argv, sklil_loader_withextra, sklil_clean);
 }
@@ -45,6 +45,32 @@ static void compute(gf_node *node)
     }
 }
 
+/*
+ * Control rate: the envelope ticks once per block, with its
+ * times divided by the block length so the segments still
+ * take as long as they should. The gate is read once per
+ * block too.
+ */
+
+static void kcompute(gf_node *node)
+{
+    int blksize;
+    struct adsr_n *adsr;
+    GFFLT out;
+
+    blksize = gf_node_blksize(node);
+
+    adsr = (struct adsr_n *)gf_node_get_data(node);
+
+    sk_adsr_attack(&adsr->adsr, gf_cable_kget(adsr->atk) / blksize);
+    sk_adsr_decay(&adsr->adsr, gf_cable_kget(adsr->dec) / blksize);
+    sk_adsr_sustain(&adsr->adsr, gf_cable_kget(adsr->sus));
+    sk_adsr_release(&adsr->adsr, gf_cable_kget(adsr->rel) / blksize);
+
+    out = sk_adsr_tick(&adsr->adsr, gf_cable_kget(adsr->gt));
+    gf_cable_kset(adsr->out, out);
+}
+
 static void destroy(gf_node *node)
 {
     gf_patch *patch;
@@ -57,7 +83,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_adsr(sk_core *core)
+static int node_adsr(sk_core *core, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -93,7 +119,8 @@ int sk_node_adsr(sk_core *core)
     rc = gf_node_cables_alloc(node, 6);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 5);
+    if (krate) gf_node_set_krate(node, 5);
+    else gf_node_set_block(node, 5);
 
     gf_node_get_cable(node, 0, &adsr->gt);
     gf_node_get_cable(node, 1, &adsr->atk);
@@ -103,7 +130,7 @@ int sk_node_adsr(sk_core *core)
     gf_node_get_cable(node, 5, &adsr->out);
 
     gf_node_set_data(node, adsr);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &gt, 0);
@@ -114,3 +141,13 @@ int sk_node_adsr(sk_core *core)
     sk_param_out(core, node, 5);
     return 0;
 }
+
+int sk_node_adsr(sk_core *core)
+{
+    return node_adsr(core, 0);
+}
+
+int sk_node_kadsr(sk_core *core)
+{
+    return node_adsr(core, 1);
+}
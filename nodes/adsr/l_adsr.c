@@ -7,6 +7,7 @@
 #include "sklil.h"
 
 int sk_node_adsr(sk_core *core);
+int sk_node_kadsr(sk_core *core);
 
 static lil_value_t adsr(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -28,7 +29,28 @@ static lil_value_t adsr(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t kadsr(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    int i;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kadsr", argc, 5);
+
+    for (i = 0; i < 5; i++) {
+        rc = sklil_param(core, argv[i]);
+        SKLIL_PARAM_CHECK(lil, rc, "kadsr");
+    }
+
+    rc = sk_node_kadsr(core);
+    SKLIL_ERROR_CHECK(lil, rc, "kadsr didn't work out.");
+    return NULL;
+}
+
 void sklil_load_adsr(lil_t lil)
 {
     lil_register(lil, "adsr", adsr);
+    lil_register(lil, "kadsr", kadsr);
 }
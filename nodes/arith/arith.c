@@ -16,19 +16,33 @@ static void add_compute(gf_node *node)
     int blksize;
     int n;
     struct arith_n *arith;
+    gf_view a, b;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     arith = (struct arith_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT a, b, out;
+    gf_cable_view(arith->a, &a);
+    gf_cable_view(arith->b, &b);
+    out = gf_cable_data(arith->out);
 
-        a = gf_cable_get(arith->a, n);
-        b = gf_cable_get(arith->b, n);
-        out = a + b;
-
-        gf_cable_set(arith->out, n, out);
+    /* 0 + 0 */
+    if (gf_cable_silent(arith->a) && gf_cable_silent(arith->b)) {
+        gf_cable_silence(arith->out);
+        return;
+    }
+    gf_cable_silent_set(arith->out, 0);
+
+    if (GF_VIEW_CONSTANT(b)) {
+        GFFLT bval = *b.ptr;
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) + bval;
+        }
+    } else {
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) + GF_VIEW(b, n);
+        }
     }
 }
 
@@ -37,19 +51,33 @@ static void mul_compute(gf_node *node)
     int blksize;
     int n;
     struct arith_n *arith;
+    gf_view a, b;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     arith = (struct arith_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT a, b, out;
+    gf_cable_view(arith->a, &a);
+    gf_cable_view(arith->b, &b);
+    out = gf_cable_data(arith->out);
 
-        a = gf_cable_get(arith->a, n);
-        b = gf_cable_get(arith->b, n);
-        out = a * b;
-
-        gf_cable_set(arith->out, n, out);
+    /* anything times 0 */
+    if (gf_cable_silent(arith->a) || gf_cable_silent(arith->b)) {
+        gf_cable_silence(arith->out);
+        return;
+    }
+    gf_cable_silent_set(arith->out, 0);
+
+    if (GF_VIEW_CONSTANT(b)) {
+        GFFLT bval = *b.ptr;
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) * bval;
+        }
+    } else {
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) * GF_VIEW(b, n);
+        }
     }
 }
 
@@ -58,19 +86,26 @@ static void div_compute(gf_node *node)
     int blksize;
     int n;
     struct arith_n *arith;
+    gf_view a, b;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     arith = (struct arith_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT a, b, out;
-
-        a = gf_cable_get(arith->a, n);
-        b = gf_cable_get(arith->b, n);
-        out = a / b; /* watch out for divide by 0 */
-
-        gf_cable_set(arith->out, n, out);
+    gf_cable_view(arith->a, &a);
+    gf_cable_view(arith->b, &b);
+    out = gf_cable_data(arith->out);
+
+    if (GF_VIEW_CONSTANT(b)) {
+        GFFLT bval = *b.ptr;
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) / bval; /* watch out for divide by 0 */
+        }
+    } else {
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) / GF_VIEW(b, n); /* watch out for divide by 0 */
+        }
     }
 }
 
@@ -79,19 +114,33 @@ static void sub_compute(gf_node *node)
     int blksize;
     int n;
     struct arith_n *arith;
+    gf_view a, b;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     arith = (struct arith_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT a, b, out;
+    gf_cable_view(arith->a, &a);
+    gf_cable_view(arith->b, &b);
+    out = gf_cable_data(arith->out);
 
-        a = gf_cable_get(arith->a, n);
-        b = gf_cable_get(arith->b, n);
-        out = a - b;
-
-        gf_cable_set(arith->out, n, out);
+    /* 0 - 0 */
+    if (gf_cable_silent(arith->a) && gf_cable_silent(arith->b)) {
+        gf_cable_silence(arith->out);
+        return;
+    }
+    gf_cable_silent_set(arith->out, 0);
+
+    if (GF_VIEW_CONSTANT(b)) {
+        GFFLT bval = *b.ptr;
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) - bval;
+        }
+    } else {
+        for (n = 0; n < blksize; n++) {
+            out[n] = GF_VIEW(a, n) - GF_VIEW(b, n);
+        }
     }
 }
 
@@ -142,6 +191,8 @@ static int node_arith(sk_core *core, gf_function compute)
 
     gf_node_set_data(node, arith);
     gf_node_set_compute(node, compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &a, 0);
@@ -0,0 +1,311 @@
+/*
+ * Batch
+ *
+ * Renders many LIL scripts, each in its own interpreter and
+ * sk_core, on a fixed pool of worker threads.
+ *
+ * An optional prelude script gets run once before the jobs.
+ * Named tables it makes (tabnew with a name) are shared
+ * with every job, which can get them with grab. Jobs must
+ * only read from these.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+#if defined(__plan9__) && !defined(GF_NOTHREADS)
+#define GF_NOTHREADS
+#endif
+
+#ifndef GF_NOTHREADS
+#include <pthread.h>
+#endif
+
+#define MAXTHREADS 64
+
+struct batch {
+    sklil_job *jobs;
+    int njobs;
+    int next;
+    sk_core *shared;
+    void (*loader)(lil_t);
+    void (*clean)(lil_t);
+#ifndef GF_NOTHREADS
+    pthread_mutex_t lock;
+#endif
+};
+
+static int next_job(struct batch *b)
+{
+    int j;
+
+#ifndef GF_NOTHREADS
+    pthread_mutex_lock(&b->lock);
+#endif
+    j = -1;
+    if (b->next < b->njobs) j = b->next++;
+#ifndef GF_NOTHREADS
+    pthread_mutex_unlock(&b->lock);
+#endif
+
+    return j;
+}
+
+static void run_job(struct batch *b, sklil_job *job)
+{
+    lil_t lil;
+
+    lil = lil_new();
+    if (b->loader != NULL) b->loader(lil);
+
+    if (b->shared != NULL) {
+        sk_core_share_tables(lil_get_data(lil), b->shared);
+    }
+
+    job->rc = lil_run(lil, job->script, job->argc, job->argv);
+
+    if (b->clean != NULL) b->clean(lil);
+    lil_free(lil);
+}
+
+static void *worker(void *ud)
+{
+    struct batch *b;
+    int j;
+
+    b = ud;
+
+    while ((j = next_job(b)) >= 0) {
+        run_job(b, &b->jobs[j]);
+    }
+
+    return NULL;
+}
+
+int sklil_batch(sklil_job *jobs, int njobs, int nthreads,
+                const char *prelude,
+                void (*loader)(lil_t),
+                void (*clean)(lil_t))
+{
+    struct batch b;
+    lil_t pre;
+    int rc;
+    int j;
+#ifndef GF_NOTHREADS
+    pthread_t thread[MAXTHREADS];
+    int t;
+#endif
+
+    b.jobs = jobs;
+    b.njobs = njobs;
+    b.next = 0;
+    b.shared = NULL;
+    b.loader = loader;
+    b.clean = clean;
+
+    pre = NULL;
+
+    if (prelude != NULL) {
+        pre = lil_new();
+        if (loader != NULL) loader(pre);
+        rc = lil_run(pre, prelude, 0, NULL);
+
+        if (rc) {
+            if (clean != NULL) clean(pre);
+            lil_free(pre);
+            return rc;
+        }
+
+        b.shared = lil_get_data(pre);
+    }
+
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > MAXTHREADS) nthreads = MAXTHREADS;
+    if (nthreads > njobs) nthreads = njobs;
+
+#ifndef GF_NOTHREADS
+    pthread_mutex_init(&b.lock, NULL);
+
+    /* the calling thread is one of the workers */
+    for (t = 1; t < nthreads; t++) {
+        if (pthread_create(&thread[t], NULL, worker, &b)) break;
+    }
+    nthreads = t;
+
+    worker(&b);
+
+    for (t = 1; t < nthreads; t++) {
+        pthread_join(thread[t], NULL);
+    }
+
+    pthread_mutex_destroy(&b.lock);
+#else
+    worker(&b);
+#endif
+
+    if (pre != NULL) {
+        if (clean != NULL) clean(pre);
+        lil_free(pre);
+    }
+
+    rc = 0;
+    for (j = 0; j < njobs; j++) {
+        if (jobs[j].rc) rc = 1;
+    }
+
+    return rc;
+}
+
+/* splits a line of the job file into words, in place */
+
+static int split(char *line, char **words, int max)
+{
+    int n;
+    char *w;
+
+    n = 0;
+    w = strtok(line, " \t\r\n");
+
+    while (w != NULL && n < max) {
+        words[n++] = w;
+        w = strtok(NULL, " \t\r\n");
+    }
+
+    return n;
+}
+
+static char *clone(const char *str)
+{
+    char *s;
+
+    s = malloc(strlen(str) + 1);
+    strcpy(s, str);
+    return s;
+}
+
+static int read_jobs(const char *filename, sklil_job **out)
+{
+    FILE *fp;
+    char line[1024];
+    char *words[64];
+    sklil_job *jobs;
+    int njobs;
+    int cap;
+    int nwords;
+    int w;
+
+    fp = stdin;
+    if (strcmp(filename, "-")) fp = fopen(filename, "r");
+
+    if (fp == NULL) {
+        fprintf(stderr, "batch: could not open %s\n", filename);
+        return -1;
+    }
+
+    jobs = NULL;
+    njobs = 0;
+    cap = 0;
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (line[0] == '#') continue;
+        nwords = split(line, words, 64);
+        if (nwords == 0) continue;
+
+        if (njobs == cap) {
+            cap = cap ? cap * 2 : 64;
+            jobs = realloc(jobs, sizeof(sklil_job) * cap);
+        }
+
+        jobs[njobs].script = clone(words[0]);
+        jobs[njobs].argc = nwords - 1;
+        jobs[njobs].argv = malloc(sizeof(char *) * nwords);
+        for (w = 1; w < nwords; w++) {
+            jobs[njobs].argv[w - 1] = clone(words[w]);
+        }
+        jobs[njobs].rc = 0;
+        njobs++;
+    }
+
+    if (fp != stdin) fclose(fp);
+
+    *out = jobs;
+    return njobs;
+}
+
+static void free_jobs(sklil_job *jobs, int njobs)
+{
+    int j;
+    int w;
+
+    for (j = 0; j < njobs; j++) {
+        for (w = 0; w < jobs[j].argc; w++) free(jobs[j].argv[w]);
+        free(jobs[j].argv);
+        free((char *)jobs[j].script);
+    }
+
+    free(jobs);
+}
+
+/*
+ * batch [-j nthreads] [-p prelude.lil] jobs.txt
+ *
+ * Each line of the job file is a script followed by its
+ * arguments, which the script sees as $argv. Lines
+ * starting with # are skipped. A job file of - reads
+ * from stdin.
+ */
+
+int sklil_batch_main(int argc, char *argv[],
+                     void (*loader)(lil_t),
+                     void (*clean)(lil_t))
+{
+    int nthreads;
+    const char *prelude;
+    const char *jobfile;
+    sklil_job *jobs;
+    int njobs;
+    int rc;
+    int i;
+    int j;
+
+    nthreads = 1;
+    prelude = NULL;
+    jobfile = NULL;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+            nthreads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+            prelude = argv[++i];
+        } else {
+            jobfile = argv[i];
+        }
+    }
+
+    if (jobfile == NULL) {
+        fprintf(stderr,
+                "usage: %s [-j nthreads] [-p prelude.lil] jobs.txt\n",
+                argv[0]);
+        return 1;
+    }
+
+    njobs = read_jobs(jobfile, &jobs);
+    if (njobs < 0) return 1;
+
+    rc = sklil_batch(jobs, njobs, nthreads, prelude, loader, clean);
+
+    for (j = 0; j < njobs; j++) {
+        if (jobs[j].rc) {
+            fprintf(stderr, "batch: %s (job %d) failed with %d\n",
+                    jobs[j].script, j + 1, jobs[j].rc);
+        }
+    }
+
+    free_jobs(jobs, njobs);
+    return rc;
+}
@@ -12,34 +12,49 @@ struct bigverb_n {
     gf_cable *cutoff;
     gf_cable *out[2];
     sk_bigverb *bigverb;
+    gf_tail tail;
 };
 
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct bigverb_n *bigverb;
+    GFFLT *out[2];
 
     blksize = gf_node_blksize(node);
 
     bigverb = (struct bigverb_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in[2], size, cutoff, out[2];
-        in[0] = gf_cable_get(bigverb->in[0], n);
-        in[1] = gf_cable_get(bigverb->in[1], n);
-        size = gf_cable_get(bigverb->size, n);
-        cutoff = gf_cable_get(bigverb->cutoff, n);
-
-        sk_bigverb_size(bigverb->bigverb, size);
-        sk_bigverb_cutoff(bigverb->bigverb, cutoff);
-        sk_bigverb_tick(bigverb->bigverb,
-                        in[0], in[1],
-                        &out[0], &out[1]);
-
-        gf_cable_set(bigverb->out[0], n, out[0]);
-        gf_cable_set(bigverb->out[1], n, out[1]);
+    out[0] = gf_cable_data(bigverb->out[0]);
+    out[1] = gf_cable_data(bigverb->out[1]);
+
+    if (gf_tail_skip(&bigverb->tail,
+                     gf_cable_silent(bigverb->in[0]) &&
+                     gf_cable_silent(bigverb->in[1]),
+                     blksize)) {
+        /* keep the jitter going, so the delay times are
+         * where they would be when the input wakes up */
+        sk_bigverb_skip(bigverb->bigverb, blksize);
+        gf_cable_silence(bigverb->out[0]);
+        gf_cable_silence(bigverb->out[1]);
+        return;
     }
+    gf_cable_silent_set(bigverb->out[0], 0);
+    gf_cable_silent_set(bigverb->out[1], 0);
+
+    /* constant cables hold these for the whole block */
+    sk_bigverb_size(bigverb->bigverb, gf_cable_get(bigverb->size, 0));
+    sk_bigverb_cutoff(bigverb->bigverb, gf_cable_get(bigverb->cutoff, 0));
+
+    sk_bigverb_compute(bigverb->bigverb, blksize,
+                       gf_cable_data(bigverb->size),
+                       gf_cable_data(bigverb->cutoff),
+                       gf_cable_input(bigverb->in[0], out[0], blksize),
+                       gf_cable_input(bigverb->in[1], out[1], blksize),
+                       out[0], out[1]);
+
+    gf_tail_check(&bigverb->tail, out[0], blksize);
+    gf_tail_check(&bigverb->tail, out[1], blksize);
 }
 
 static void destroy(gf_node *node)
@@ -68,6 +83,8 @@ int sk_node_bigverb(sk_core *core)
     void *ud;
     struct bigverb_n *bigverb;
     int sr;
+    int i;
+    size_t hold;
 
     rc = sk_param_get(core, &cutoff);
     SK_ERROR_CHECK(rc);
@@ -87,6 +104,15 @@ int sk_node_bigverb(sk_core *core)
     sr = gf_patch_srate_get(patch);
     bigverb->bigverb = sk_bigverb_new(sr);
 
+    /* wait for the longest delay line to go quiet */
+    hold = 0;
+    for (i = 0; i < 8; i++) {
+        if (bigverb->bigverb->delay[i].sz > hold) {
+            hold = bigverb->bigverb->delay[i].sz;
+        }
+    }
+    gf_tail_init(&bigverb->tail, hold);
+
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
 
@@ -12,61 +12,87 @@ struct butterworth_n {
     gf_cable *bw;
     gf_cable *out;
     sk_butterworth butterworth;
+    gf_tail tail;
 };
 
 static void compute(gf_node *node,
-                    SKFLT (tick)(sk_butterworth*,SKFLT))
+                    void (*filter)(sk_butterworth*,
+                                   int,
+                                   const SKFLT*,
+                                   const SKFLT*,
+                                   SKFLT*))
 {
     int blksize;
-    int n;
     struct butterworth_n *butterworth;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     butterworth = (struct butterworth_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, freq, out;
-        in = gf_cable_get(butterworth->in, n);
-        freq = gf_cable_get(butterworth->freq, n);
-        sk_butterworth_freq(&butterworth->butterworth, freq);
+    out = gf_cable_data(butterworth->out);
 
-        out = tick(&butterworth->butterworth, in);
-        gf_cable_set(butterworth->out, n, out);
+    if (gf_tail_skip(&butterworth->tail,
+                     gf_cable_silent(butterworth->in),
+                     blksize)) {
+        gf_cable_silence(butterworth->out);
+        return;
     }
+    gf_cable_silent_set(butterworth->out, 0);
+
+    sk_butterworth_freq(&butterworth->butterworth,
+                        gf_cable_get(butterworth->freq, 0));
+
+    filter(&butterworth->butterworth, blksize,
+           gf_cable_data(butterworth->freq),
+           gf_cable_input(butterworth->in, out, blksize),
+           out);
+
+    gf_tail_check(&butterworth->tail, out, blksize);
 }
 
 static void butlp(gf_node *node)
 {
-    compute(node, sk_butlp_tick);
+    compute(node, sk_butlp_compute);
 }
 
 static void buthp(gf_node *node)
 {
-    compute(node, sk_buthp_tick);
+    compute(node, sk_buthp_compute);
 }
 
 static void butbp(gf_node *node)
 {
     int blksize;
-    int n;
     struct butterworth_n *butterworth;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     butterworth = (struct butterworth_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, freq, bw, out;
-        in = gf_cable_get(butterworth->in, n);
-        freq = gf_cable_get(butterworth->freq, n);
-        sk_butterworth_freq(&butterworth->butterworth, freq);
-        bw = gf_cable_get(butterworth->bw, n);
-        sk_butterworth_bandwidth(&butterworth->butterworth, bw);
+    out = gf_cable_data(butterworth->out);
 
-        out = sk_butbp_tick(&butterworth->butterworth, in);
-        gf_cable_set(butterworth->out, n, out);
+    if (gf_tail_skip(&butterworth->tail,
+                     gf_cable_silent(butterworth->in),
+                     blksize)) {
+        gf_cable_silence(butterworth->out);
+        return;
     }
+    gf_cable_silent_set(butterworth->out, 0);
+
+    sk_butterworth_freq(&butterworth->butterworth,
+                        gf_cable_get(butterworth->freq, 0));
+    sk_butterworth_bandwidth(&butterworth->butterworth,
+                             gf_cable_get(butterworth->bw, 0));
+
+    sk_butbp_compute(&butterworth->butterworth, blksize,
+                     gf_cable_data(butterworth->freq),
+                     gf_cable_data(butterworth->bw),
+                     gf_cable_input(butterworth->in, out, blksize),
+                     out);
+
+    gf_tail_check(&butterworth->tail, out, blksize);
 }
 
 static void destroy(gf_node *node)
@@ -105,6 +131,7 @@ static int butterworth_node(sk_core *core, gf_function compute)
 
     sr = gf_patch_srate_get(patch);
     sk_butterworth_init(&butterworth->butterworth, sr);
+    gf_tail_init(&butterworth->tail, 1);
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
@@ -165,6 +192,7 @@ int sk_node_butbp(sk_core *core)
 
     sr = gf_patch_srate_get(patch);
     sk_butterworth_init(&butterworth->butterworth, sr);
+    gf_tail_init(&butterworth->tail, 1);
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
@@ -17,6 +17,7 @@ static void compute(gf_node *node)
     blksize = gf_node_blksize(node);
     cab = gf_node_get_data(node);
 
+    /* the data only: the silent flag belongs to the owner */
     for(s = 0; s < blksize; s++) {
         gf_cable_set(cab, s, 0.0);
     }
@@ -25,6 +26,8 @@ static void compute(gf_node *node)
 int gf_node_cabclr(gf_node *node, gf_cable *cab)
 {
     gf_node_set_compute(node, compute);
+    /* writes to a cable it doesn't own */
+    gf_node_set_flags(node, GF_NODE_SERIAL);
     gf_node_set_data(node, cab);
     return GF_OK;
 }
@@ -24,6 +24,10 @@ static void compute(gf_node *node)
     gf_node_get_cable(node, 1, &mix);
     sum = gf_node_get_data(node);
 
+    /* nothing to add */
+    if (gf_cable_silent(in) || gf_cable_silent(mix)) return;
+    gf_cable_silent_set(sum, 0);
+
     for(s = 0; s < blksize; s++) {
         f_in = gf_cable_get(in, s);
         f_mix = gf_cable_get(mix, s);
@@ -39,6 +43,8 @@ int gf_node_mix(gf_node *node, gf_cable *sum)
     rc = gf_node_cables_alloc(node, 2);
     if (rc != GF_OK) return rc;
     gf_node_set_compute(node, compute);
+    /* writes to a cable it doesn't own */
+    gf_node_set_flags(node, GF_NODE_SERIAL);
     gf_node_set_data(node, sum);
 
     return GF_OK;
@@ -11,16 +11,10 @@
 
 static void compute(gf_node *node)
 {
-    int blksize;
-    int s;
     gf_cable *out;
 
-    blksize = gf_node_blksize(node);
     gf_node_get_cable(node, 0, &out);
-
-    for(s = 0; s < blksize; s++) {
-        gf_cable_set(out, s, 0);
-    }
+    gf_cable_silence(out);
 }
 
 int gf_node_zero(gf_node *node)
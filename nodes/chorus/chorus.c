@@ -1,3 +1,4 @@
+#include <math.h>
 #include "graforge.h"
 #include "core.h"
 #include "dsp/chorus.h"
@@ -9,6 +10,7 @@ struct chorus_n {
     gf_cable *mix;
     gf_cable *out;
     sk_chorus *chorus;
+    gf_tail tail;
 };
 
 static void compute(gf_node *node)
@@ -21,6 +23,18 @@ static void compute(gf_node *node)
 
     chorus = (struct chorus_n *)gf_node_get_data(node);
 
+    if (gf_tail_skip(&chorus->tail, gf_cable_silent(chorus->in), blksize)) {
+        /* keep the LFO going, so it's in the same place
+         * when the input wakes up */
+        for (n = 0; n < blksize; n++) {
+            sk_chorus_rate(chorus->chorus, gf_cable_get(chorus->rate, n));
+            sk_chorus_skip(chorus->chorus, 1);
+        }
+        gf_cable_silence(chorus->out);
+        return;
+    }
+    gf_cable_silent_set(chorus->out, 0);
+
     for (n = 0; n < blksize; n++) {
         GFFLT in, rate, depth, mix, out;
 
@@ -36,6 +50,8 @@ static void compute(gf_node *node)
 
         gf_cable_set(chorus->out, n, out);
     }
+
+    gf_tail_check(&chorus->tail, gf_cable_data(chorus->out), blksize);
 }
 
 static void destroy(gf_node *node)
@@ -83,6 +99,7 @@ int sk_node_chorus(sk_core *core)
 
     sr = gf_patch_srate_get(patch);
     chorus->chorus = sk_chorus_new(sr, delay);
+    gf_tail_init(&chorus->tail, floor(delay * sr) + 1);
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
@@ -1,6 +1,7 @@
 SRC+=\
 nodes/sklil.c \
 nodes/sklil.h \
+nodes/batch.c \
 nodes/loader.c \
 nodes/sknodes.h \
 nodes/dr_wav.h
@@ -67,3 +68,8 @@ include nodes/lpf/config.mk
 include nodes/envar/config.mk
 include nodes/euclid/config.mk
 include nodes/gtick/config.mk
+include nodes/oversample/config.mk
+include nodes/oscbank/config.mk
+include nodes/sosbank/config.mk
+include nodes/modalbank/config.mk
+include nodes/ensemble/config.mk
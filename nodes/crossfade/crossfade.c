@@ -17,20 +17,22 @@ static void compute(gf_node *node)
     int blksize;
     int n;
     struct crossfade_n *crossfade;
+    gf_view a, b, pos;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     crossfade = (struct crossfade_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT a, b, pos, out;
-
-        a = gf_cable_get(crossfade->a, n);
-        b = gf_cable_get(crossfade->b, n);
-        pos = gf_cable_get(crossfade->pos, n);
+    gf_cable_view(crossfade->a, &a);
+    gf_cable_view(crossfade->b, &b);
+    gf_cable_view(crossfade->pos, &pos);
+    out = gf_cable_data(crossfade->out);
 
-        out = sk_crossfade_linear(a, b, pos);
-        gf_cable_set(crossfade->out, n, out);
+    for (n = 0; n < blksize; n++) {
+        out[n] = sk_crossfade_linear(GF_VIEW(a, n),
+                                     GF_VIEW(b, n),
+                                     GF_VIEW(pos, n));
     }
 }
 
@@ -87,6 +89,8 @@ int sk_node_crossfade(sk_core *core)
 
     gf_node_set_data(node, crossfade);
     gf_node_set_compute(node, compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &a, 0);
@@ -0,0 +1,4 @@
+OBJ+=nodes/ensemble/ensemble.o
+OBJ+=nodes/ensemble/l_ensemble.o
+SRC+=nodes/ensemble/ensemble.c
+SRC+=nodes/ensemble/l_ensemble.c
@@ -0,0 +1,105 @@
+/*
+ * Ensemble
+ *
+ * A group of voices, each a glottis going into a tract,
+ * mixed together. The voices are set up from a table, with
+ * 6 values for each voice: frequency, tenseness, tongue
+ * position, tongue diameter, velum, and amplitude. The
+ * number of voices is the size of the table divided by 6,
+ * up to 16. The table gets read at the start of every
+ * block.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "graforge.h"
+#include "core.h"
+#define SK_ENSEMBLE_PRIV
+#include "dsp/ensemble.h"
+
+struct ensemble_n {
+    gf_cable *out;
+    sk_table *tab;
+    sk_ensemble e;
+};
+
+static void compute(gf_node *node)
+{
+    int blksize;
+    struct ensemble_n *en;
+    SKFLT *tab;
+    int nvoices;
+    int v;
+
+    blksize = gf_node_blksize(node);
+    en = (struct ensemble_n *)gf_node_get_data(node);
+    tab = sk_table_data(en->tab);
+    nvoices = sk_ensemble_nvoices(&en->e);
+
+    for (v = 0; v < nvoices; v++) {
+        SKFLT *p;
+        p = &tab[6*v];
+        sk_ensemble_freq(&en->e, v, p[0]);
+        sk_ensemble_tenseness(&en->e, v, p[1]);
+        sk_ensemble_tongue(&en->e, v, p[2], p[3]);
+        sk_ensemble_velum(&en->e, v, p[4]);
+        sk_ensemble_amp(&en->e, v, p[5]);
+    }
+
+    sk_ensemble_compute(&en->e, blksize, gf_cable_data(en->out));
+}
+
+static void destroy(gf_node *node)
+{
+    gf_patch *patch;
+    int rc;
+    void *ud;
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    ud = gf_node_get_data(node);
+    gf_memory_free(patch, &ud);
+}
+
+int sk_node_ensemble(sk_core *core)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    sk_table *tab;
+    void *ud;
+    struct ensemble_n *en;
+    int nvoices;
+
+    rc = sk_core_table_pop(core, &tab);
+    SK_ERROR_CHECK(rc);
+
+    nvoices = sk_table_size(tab) / 6;
+    if (nvoices < 1) return 1;
+
+    patch = sk_core_patch(core);
+
+    rc = gf_memory_alloc(patch, sizeof(struct ensemble_n), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    en = (struct ensemble_n *)ud;
+
+    sk_ensemble_init(&en->e, gf_patch_srate_get(patch), nvoices);
+    en->tab = tab;
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 0);
+
+    gf_node_get_cable(node, 0, &en->out);
+
+    gf_node_set_data(node, en);
+    gf_node_set_compute(node, compute);
+    gf_node_set_destroy(node, destroy);
+
+    sk_param_out(core, node, 0);
+    return 0;
+}
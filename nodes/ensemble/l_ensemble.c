@@ -0,0 +1,28 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+int sk_node_ensemble(sk_core *core);
+
+/* ensemble tab */
+static lil_value_t l_ensemble(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "ensemble", argc, 1);
+
+    rc = sk_node_ensemble(core);
+    SKLIL_ERROR_CHECK(lil, rc, "ensemble didn't work out.");
+    return NULL;
+}
+
+void sklil_load_ensemble(lil_t lil)
+{
+    lil_register(lil, "ensemble", l_ensemble);
+}
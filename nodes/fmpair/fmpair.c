@@ -19,35 +19,30 @@ struct fmpair_n {
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct fmpair_n *fmpair;
+    sk_fmpair *fmp;
 
     blksize = gf_node_blksize(node);
 
     fmpair = (struct fmpair_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out;
-        GFFLT car;
-        GFFLT mod;
-        GFFLT index;
-        GFFLT feedback;
-        GFFLT freq;
-        freq = gf_cable_get(fmpair->freq, n);
-        car = gf_cable_get(fmpair->car, n);
-        mod = gf_cable_get(fmpair->mod, n);
-        index = gf_cable_get(fmpair->index, n);
-        feedback = gf_cable_get(fmpair->feedback, n);
-
-        sk_fmpair_freq(&fmpair->fmpair.fmpair, freq);
-        sk_fmpair_carrier(&fmpair->fmpair.fmpair, car);
-        sk_fmpair_modulator(&fmpair->fmpair.fmpair, mod);
-        sk_fmpair_modindex(&fmpair->fmpair.fmpair, index);
-        sk_fmpair_fdbk_amt(&fmpair->fmpair, feedback);
-        out = sk_fmpair_fdbk_tick(&fmpair->fmpair);
-
-        gf_cable_set(fmpair->out, n, out);
-    }
+    fmp = &fmpair->fmpair.fmpair;
+
+    /* constant cables hold these for the whole block */
+    sk_fmpair_freq(fmp, gf_cable_get(fmpair->freq, 0));
+    sk_fmpair_carrier(fmp, gf_cable_get(fmpair->car, 0));
+    sk_fmpair_modulator(fmp, gf_cable_get(fmpair->mod, 0));
+    sk_fmpair_modindex(fmp, gf_cable_get(fmpair->index, 0));
+    sk_fmpair_fdbk_amt(&fmpair->fmpair,
+                       gf_cable_get(fmpair->feedback, 0));
+
+    sk_fmpair_fdbk_compute(&fmpair->fmpair, blksize,
+                           gf_cable_data(fmpair->freq),
+                           gf_cable_data(fmpair->car),
+                           gf_cable_data(fmpair->mod),
+                           gf_cable_data(fmpair->index),
+                           gf_cable_data(fmpair->feedback),
+                           gf_cable_data(fmpair->out));
 }
 
 static void destroy(gf_node *node)
@@ -72,6 +72,11 @@ void sklil_load_lpf(lil_t lil);
 void sklil_load_envar(lil_t lil);
 void sklil_load_euclid(lil_t lil);
 void sklil_load_gtick(lil_t lil);
+void sklil_load_oversample(lil_t lil);
+void sklil_load_oscbank(lil_t lil);
+void sklil_load_sosbank(lil_t lil);
+void sklil_load_modalbank(lil_t lil);
+void sklil_load_ensemble(lil_t lil);
 
 void sklil_nodes(lil_t lil)
 {
@@ -139,6 +144,11 @@ void sklil_nodes(lil_t lil)
     sklil_load_envar(lil);
     sklil_load_euclid(lil);
     sklil_load_gtick(lil);
+    sklil_load_oversample(lil);
+    sklil_load_oscbank(lil);
+    sklil_load_sosbank(lil);
+    sklil_load_modalbank(lil);
+    sklil_load_ensemble(lil);
 }
 
 static lil_value_t computes(lil_t lil, size_t argc, lil_value_t *argv)
@@ -181,6 +191,323 @@ static lil_value_t param(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t live(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_live *lv;
+    const char *key;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "live", argc, 1);
+
+    rc = sk_core_live(core, lil_to_double(argv[0]), &lv);
+    SKLIL_ERROR_CHECK(lil, rc, "live: could not create.");
+
+    if (argc > 1) {
+        key = lil_to_string(argv[1]);
+        rc = sk_core_live_append(core, key, strlen(key), lv);
+        SKLIL_ERROR_CHECK(lil, rc, "live: name already taken.");
+    }
+
+    return NULL;
+}
+
+/* liveset target val [time]: target is a register or a name */
+static lil_value_t liveset(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_live *lv;
+    const char *key;
+    unsigned long time;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "liveset", argc, 2);
+
+    key = lil_to_string(argv[0]);
+
+    if (key[0] >= '0' && key[0] <= '9') {
+        rc = sk_core_live_reg(core, lil_to_integer(argv[0]), &lv);
+    } else {
+        rc = sk_core_live_find(core, key, strlen(key), &lv);
+    }
+
+    SKLIL_ERROR_CHECK(lil, rc, "liveset: could not find live value.");
+
+    time = 0;
+    if (argc > 2) time = lil_to_integer(argv[2]);
+
+    rc = sk_core_pqpush(core, lv, time, lil_to_double(argv[1]));
+    SKLIL_ERROR_CHECK(lil, rc, "liveset: queue is full.");
+
+    return NULL;
+}
+
+struct polytpl {
+    lil_t lil;
+    lil_value_t code;
+};
+
+/* the template is run once per voice */
+static int poly_voice(sk_core *core, void *ud)
+{
+    struct polytpl *tpl;
+
+    tpl = ud;
+    lil_free_value(lil_parse_value(tpl->lil, tpl->code, 0));
+
+    return 0;
+}
+
+/* poly nvoices {template} [name] */
+static lil_value_t poly(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_poly *p;
+    struct polytpl tpl;
+    const char *key;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "poly", argc, 2);
+
+    tpl.lil = lil;
+    tpl.code = argv[1];
+
+    rc = sk_core_poly(core, lil_to_integer(argv[0]), poly_voice, &tpl, &p);
+    SKLIL_ERROR_CHECK(lil, rc, "poly: could not build voices.");
+
+    if (argc > 2) {
+        key = lil_to_string(argv[2]);
+        rc = sk_core_poly_append(core, key, strlen(key), p);
+        SKLIL_ERROR_CHECK(lil, rc, "poly: name already taken.");
+    }
+
+    return NULL;
+}
+
+/* voice gate|note|vel: only works inside a poly template */
+static lil_value_t voice(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    const char *ctl;
+    int c;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "voice", argc, 1);
+
+    ctl = lil_to_string(argv[0]);
+
+    c = -1;
+    if (!strcmp(ctl, "gate")) c = SK_VOICE_GATE;
+    else if (!strcmp(ctl, "note")) c = SK_VOICE_NOTE;
+    else if (!strcmp(ctl, "vel")) c = SK_VOICE_VEL;
+
+    rc = sk_core_voice(core, c);
+    SKLIL_ERROR_CHECK(lil, rc, "voice: not in a poly, or bad control.");
+
+    return NULL;
+}
+
+static int find_poly(lil_t lil, lil_value_t name, sk_poly **p)
+{
+    sk_core *core;
+    const char *key;
+
+    core = lil_get_data(lil);
+    key = lil_to_string(name);
+
+    return sk_core_poly_find(core, key, strlen(key), p);
+}
+
+/* noteon poly note vel [time] */
+static lil_value_t noteon(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_poly *p;
+    unsigned long time;
+    int rc;
+
+    SKLIL_ARITY_CHECK(lil, "noteon", argc, 3);
+
+    rc = find_poly(lil, argv[0], &p);
+    SKLIL_ERROR_CHECK(lil, rc, "noteon: could not find poly.");
+
+    time = 0;
+    if (argc > 3) time = lil_to_integer(argv[3]);
+
+    rc = sk_poly_noteon(p, time,
+                        lil_to_double(argv[1]),
+                        lil_to_double(argv[2]));
+    SKLIL_ERROR_CHECK(lil, rc, "noteon: queue is full.");
+
+    return NULL;
+}
+
+/* noteoff poly note [time] */
+static lil_value_t noteoff(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_poly *p;
+    unsigned long time;
+    int rc;
+
+    SKLIL_ARITY_CHECK(lil, "noteoff", argc, 2);
+
+    rc = find_poly(lil, argv[0], &p);
+    SKLIL_ERROR_CHECK(lil, rc, "noteoff: could not find poly.");
+
+    time = 0;
+    if (argc > 2) time = lil_to_integer(argv[2]);
+
+    rc = sk_poly_noteoff(p, time, lil_to_double(argv[1]));
+    SKLIL_ERROR_CHECK(lil, rc, "noteoff: queue is full.");
+
+    return NULL;
+}
+
+/* swapnew name fade: plays a swapper in the patch */
+static lil_value_t swapnew(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_swap *swap;
+    const char *key;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "swapnew", argc, 2);
+
+    key = lil_to_string(argv[0]);
+    swap = sk_swap_new(gf_patch_blksize(sk_core_patch(core)),
+                       lil_to_integer(argv[1]));
+
+    rc = sk_core_swap_append(core, key, strlen(key), swap);
+    if (rc) sk_swap_del(swap);
+    SKLIL_ERROR_CHECK(lil, rc, "swapnew: name already taken.");
+
+    rc = sk_core_swapper(core, swap);
+    SKLIL_ERROR_CHECK(lil, rc, "swapnew: could not create.");
+
+    return NULL;
+}
+
+/* swapsub name {patch}: builds a core and submits it */
+static lil_value_t swapsub(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_core *sub;
+    sk_swap *swap;
+    gf_patch *patch;
+    const char *key;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "swapsub", argc, 2);
+
+    key = lil_to_string(argv[0]);
+    rc = sk_core_swap_find(core, key, strlen(key), &swap);
+    SKLIL_ERROR_CHECK(lil, rc, "swapsub: could not find swapper.");
+
+    patch = sk_core_patch(core);
+    sub = sk_core_new(gf_patch_srate_get(patch),
+                      gf_patch_blksize(patch));
+
+    lil_set_data(lil, sub);
+    lil_free_value(lil_parse_value(lil, argv[1], 0));
+    lil_set_data(lil, core);
+
+    /* same thread as the render, so collect here */
+    sk_swap_collect(swap);
+
+    rc = sk_swap_submit(swap, sub);
+    if (rc) sk_core_del(sub);
+    SKLIL_ERROR_CHECK(lil, rc, "swapsub: swapper is busy.");
+
+    return NULL;
+}
+
+/* swaplat name [expected]: latency of the last swap */
+static lil_value_t swaplat(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    sk_swap *swap;
+    const char *key;
+    unsigned long last;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "swaplat", argc, 1);
+
+    key = lil_to_string(argv[0]);
+    rc = sk_core_swap_find(core, key, strlen(key), &swap);
+    SKLIL_ERROR_CHECK(lil, rc, "swaplat: could not find swapper.");
+
+    sk_swap_latency(swap, &last, NULL);
+
+    if (argc > 1 && last != (unsigned long)lil_to_integer(argv[1])) {
+        char str[64];
+        sprintf(str, "swaplat: expected %ld, got %lu",
+                (long)lil_to_integer(argv[1]), last);
+        lil_set_error(lil, str);
+        lil_set_errcode(lil, 1);
+        return NULL;
+    }
+
+    return lil_alloc_integer(last);
+}
+
+struct atcode {
+    lil_t lil;
+    lil_value_t code;
+};
+
+static void at_fire(sk_core *core, void *ud)
+{
+    struct atcode *at;
+
+    at = ud;
+    lil_free_value(lil_parse_value(at->lil, at->code, 0));
+}
+
+static void at_free(void *ud)
+{
+    struct atcode *at;
+
+    at = ud;
+    lil_free_value(at->code);
+    free(at);
+}
+
+/* at time {code}: runs code right before sample time */
+static lil_value_t at(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    struct atcode *a;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "at", argc, 2);
+
+    a = malloc(sizeof(struct atcode));
+    a->lil = lil;
+    a->code = lil_clone_value(argv[1]);
+
+    rc = sk_core_event(core, lil_to_integer(argv[0]), at_fire, at_free, a);
+
+    if (rc) at_free(a);
+    SKLIL_ERROR_CHECK(lil, rc, "at: queue is full.");
+
+    return NULL;
+}
+
 static lil_value_t regnxt(lil_t lil, size_t argc, lil_value_t *argv)
 {
     sk_core *core;
@@ -310,6 +637,128 @@ static lil_value_t l_blkset(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t l_blkmax(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int sz;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "blkmax", argc, 1);
+
+    sz = lil_to_integer(argv[0]);
+    rc = sk_core_blkmax(core, sz);
+
+    SKLIL_ERROR_CHECK(lil, rc, "blkmax failed.");
+
+    return NULL;
+}
+
+static lil_value_t l_klerp(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "klerp", argc, 1);
+
+    sk_core_klerp(core, lil_to_integer(argv[0]));
+
+    return NULL;
+}
+
+static lil_value_t l_threads(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "threads", argc, 1);
+
+    rc = sk_core_threads(core, lil_to_integer(argv[0]));
+
+    SKLIL_ERROR_CHECK(lil, rc, "threads not supported.");
+
+    return NULL;
+}
+
+static lil_value_t l_optimize(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    rc = sk_core_optimize(core);
+
+    SKLIL_ERROR_CHECK(lil, rc, "optimize failed.");
+
+    return NULL;
+}
+
+static lil_value_t l_arena(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    unsigned long sz;
+
+    core = lil_get_data(lil);
+
+    sz = 0;
+    if (argc > 0) sz = lil_to_integer(argv[0]);
+
+    rc = sk_core_arena(core, sz);
+
+    SKLIL_ERROR_CHECK(lil, rc, "arena already allocated.");
+
+    return NULL;
+}
+
+static lil_value_t l_profile(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    int on;
+
+    core = lil_get_data(lil);
+
+    on = 1;
+    if (argc > 0) on = lil_to_integer(argv[0]);
+
+    rc = sk_core_profile(core, on);
+
+    SKLIL_ERROR_CHECK(lil, rc, "built without GF_PROFILE.");
+
+    return NULL;
+}
+
+static lil_value_t l_profdump(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    const char *filename;
+
+    core = lil_get_data(lil);
+
+    filename = NULL;
+    if (argc > 0) filename = lil_to_string(argv[0]);
+
+    rc = sk_core_profdump(core, filename);
+
+    SKLIL_ERROR_CHECK(lil, rc, "could not write profile.");
+
+    return NULL;
+}
+
+#ifdef GF_PROFILE
+static void tag_node(lil_t lil, const char *name)
+{
+    sk_core_tag(lil_get_data(lil), name);
+}
+#endif
+
 static lil_value_t l_stackpos(lil_t lil, size_t argc, lil_value_t *argv)
 {
     sk_core *core;
@@ -319,6 +768,24 @@ static lil_value_t l_stackpos(lil_t lil, size_t argc, lil_value_t *argv)
     return lil_alloc_integer(sk_core_stackpos(core));
 }
 
+static lil_value_t l_bufpeak(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+
+    core = lil_get_data(lil);
+
+    return lil_alloc_integer(sk_core_bufpeak(core));
+}
+
+static lil_value_t l_stkpeak(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+
+    core = lil_get_data(lil);
+
+    return lil_alloc_integer(sk_core_stkpeak(core));
+}
+
 static lil_value_t l_unholdall(lil_t lil, size_t argc, lil_value_t *argv)
 {
     sk_core *core;
@@ -409,12 +876,22 @@ static lil_value_t l_setsr(lil_t lil,
 void sklil_loader(lil_t lil)
 {
     sk_core *core;
-    core = sk_core_new(44100);
+    core = sk_core_new(44100, 64);
     lil_set_data(lil, core);
     sklil_nodes(lil);
     lil_register(lil, "compute", compute);
     lil_register(lil, "computes", computes);
     lil_register(lil, "param", param);
+    lil_register(lil, "live", live);
+    lil_register(lil, "liveset", liveset);
+    lil_register(lil, "poly", poly);
+    lil_register(lil, "voice", voice);
+    lil_register(lil, "noteon", noteon);
+    lil_register(lil, "noteoff", noteoff);
+    lil_register(lil, "swapnew", swapnew);
+    lil_register(lil, "swapsub", swapsub);
+    lil_register(lil, "swaplat", swaplat);
+    lil_register(lil, "at", at);
     lil_register(lil, "regnxt", regnxt);
     lil_register(lil, "regmrk", regmrk);
     lil_register(lil, "regclr", regclr);
@@ -423,12 +900,24 @@ void sklil_loader(lil_t lil)
     lil_register(lil, "randf", l_randf);
     lil_register(lil, "grab", l_grab);
     lil_register(lil, "blkset", l_blkset);
+    lil_register(lil, "blkmax", l_blkmax);
+    lil_register(lil, "klerp", l_klerp);
+    lil_register(lil, "threads", l_threads);
+    lil_register(lil, "arena", l_arena);
+    lil_register(lil, "optimize", l_optimize);
+    lil_register(lil, "profile", l_profile);
+    lil_register(lil, "profdump", l_profdump);
     lil_register(lil, "stkpos", l_stackpos);
+    lil_register(lil, "bufpeak", l_bufpeak);
+    lil_register(lil, "stkpeak", l_stkpeak);
     lil_register(lil, "unholdall", l_unholdall);
     lil_register(lil, "pop", l_pop);
     lil_register(lil, "del", l_del);
     lil_register(lil, "lscmds", l_lscmds);
     lil_register(lil, "setsr", l_setsr);
+#ifdef GF_PROFILE
+    lil_callback(lil, LIL_CALLBACK_CALL, (lil_callback_proc_t)tag_node);
+#endif
 }
 
 void sklil_clean(lil_t lil)
@@ -0,0 +1,4 @@
+OBJ+=nodes/modalbank/modalbank.o
+OBJ+=nodes/modalbank/l_modalbank.o
+SRC+=nodes/modalbank/modalbank.c
+SRC+=nodes/modalbank/l_modalbank.c
@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+int sk_node_modalbank(sk_core *core);
+
+/* modalbank freqs qs gains in */
+static lil_value_t modalbank(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "modalbank", argc, 4);
+
+    rc = sklil_param(core, argv[3]);
+    SKLIL_PARAM_CHECK(lil, rc, "modalbank");
+
+    rc = sk_node_modalbank(core);
+    SKLIL_ERROR_CHECK(lil, rc, "modalbank didn't work out.");
+    return NULL;
+}
+
+void sklil_load_modalbank(lil_t lil)
+{
+    lil_register(lil, "modalbank", modalbank);
+}
@@ -0,0 +1,159 @@
+/*
+ * Modal Bank
+ *
+ * A set of resonant modes, like modalres, all driven by the
+ * same input and summed into one output. The frequency, Q,
+ * and gain of each mode come from three tables, which get
+ * read at the start of every block. Modes only get their
+ * filter coefficients worked out again when their frequency
+ * or Q changes.
+ */
+
+#include <stdlib.h>
+#include "graforge.h"
+#include "core.h"
+#define SK_MODALBANK_PRIV
+#include "dsp/modalbank.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+struct modalbank_n {
+    gf_cable *in;
+    gf_cable *out;
+    sk_table *freq;
+    sk_table *q;
+    sk_table *gain;
+    gf_tail tail;
+    sk_modalbank mb;
+};
+
+/* how long a mode takes to die away, in samples, worked
+ * out the same way as in modalres */
+
+static int ring_hold(SKFLT freq, SKFLT q, int sr)
+{
+    SKFLT t;
+
+    if (freq < 1) freq = 1;
+    if (q < 1) q = 1;
+    t = q / (M_PI * freq);
+    if (t < 1.0 / freq) t = 1.0 / freq;
+    /* keeps it in an int */
+    if (t > 600) t = 600;
+
+    return (int)(t * sr) + 1;
+}
+
+static void compute(gf_node *node)
+{
+    int blksize;
+    struct modalbank_n *mn;
+    GFFLT *out;
+    SKFLT *freq, *q, *gain;
+    int nmodes;
+    int k;
+    int hold, h;
+
+    blksize = gf_node_blksize(node);
+    mn = (struct modalbank_n *)gf_node_get_data(node);
+
+    if (gf_tail_skip(&mn->tail, gf_cable_silent(mn->in), blksize)) {
+        gf_cable_silence(mn->out);
+        return;
+    }
+    gf_cable_silent_set(mn->out, 0);
+
+    out = gf_cable_data(mn->out);
+    freq = sk_table_data(mn->freq);
+    q = sk_table_data(mn->q);
+    gain = sk_table_data(mn->gain);
+    nmodes = sk_modalbank_nmodes_get(&mn->mb);
+
+    hold = 1;
+    for (k = 0; k < nmodes; k++) {
+        sk_modalbank_mode(&mn->mb, k, freq[k], q[k], gain[k]);
+        h = ring_hold(freq[k], q[k], mn->mb.sr);
+        if (h > hold) hold = h;
+    }
+    gf_tail_hold(&mn->tail, hold);
+
+    sk_modalbank_compute(&mn->mb, blksize,
+                         gf_cable_input(mn->in, out, blksize),
+                         out);
+
+    gf_tail_check(&mn->tail, out, blksize);
+}
+
+static void destroy(gf_node *node)
+{
+    gf_patch *patch;
+    int rc;
+    void *ud;
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    ud = gf_node_get_data(node);
+    gf_memory_free(patch, &ud);
+}
+
+int sk_node_modalbank(sk_core *core)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    sk_param in;
+    sk_table *freq, *q, *gain;
+    void *ud;
+    struct modalbank_n *mn;
+    int nmodes;
+
+    rc = sk_param_get(core, &in);
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_core_table_pop(core, &gain);
+    SK_ERROR_CHECK(rc);
+    rc = sk_core_table_pop(core, &q);
+    SK_ERROR_CHECK(rc);
+    rc = sk_core_table_pop(core, &freq);
+    SK_ERROR_CHECK(rc);
+
+    /* one mode for each entry all three tables have */
+    nmodes = sk_table_size(freq);
+    if (sk_table_size(q) < nmodes) nmodes = sk_table_size(q);
+    if (sk_table_size(gain) < nmodes) nmodes = sk_table_size(gain);
+
+    patch = sk_core_patch(core);
+
+    rc = gf_memory_alloc(patch, sizeof(struct modalbank_n), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    mn = (struct modalbank_n *)ud;
+
+    sk_modalbank_init(&mn->mb, gf_patch_srate_get(patch));
+    sk_modalbank_nmodes(&mn->mb, nmodes);
+    mn->freq = freq;
+    mn->q = q;
+    mn->gain = gain;
+    /* set from the longest ringing mode every block */
+    gf_tail_init(&mn->tail, 1);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 2);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 1);
+
+    gf_node_get_cable(node, 0, &mn->in);
+    gf_node_get_cable(node, 1, &mn->out);
+
+    gf_node_set_data(node, mn);
+    gf_node_set_compute(node, compute);
+    gf_node_set_destroy(node, destroy);
+
+    sk_param_set(core, node, &in, 0);
+    sk_param_out(core, node, 1);
+    return 0;
+}
@@ -6,14 +6,38 @@
 #define SK_MODALRES_PRIV
 #include "dsp/modalres.h"
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 struct modalres_n {
     gf_cable *in;
     gf_cable *freq;
     gf_cable *q;
     gf_cable *out;
     sk_modalres modalres;
+    gf_tail tail;
 };
 
+/* how long the ring takes to die away, in samples: the
+ * time constant of the decay, or one period if that's
+ * longer, so a quiet zero crossing isn't taken for the
+ * end of it. Low, sharp modes ring for a long time. */
+
+static int ring_hold(SKFLT freq, SKFLT q, int sr)
+{
+    SKFLT t;
+
+    if (freq < 1) freq = 1;
+    if (q < 1) q = 1;
+    t = q / (M_PI * freq);
+    if (t < 1.0 / freq) t = 1.0 / freq;
+    /* keeps it in an int */
+    if (t > 600) t = 600;
+
+    return (int)(t * sr) + 1;
+}
+
 static void compute(gf_node *node)
 {
     int blksize;
@@ -24,6 +48,12 @@ static void compute(gf_node *node)
 
     modalres = (struct modalres_n *)gf_node_get_data(node);
 
+    if (gf_tail_skip(&modalres->tail, gf_cable_silent(modalres->in), blksize)) {
+        gf_cable_silence(modalres->out);
+        return;
+    }
+    gf_cable_silent_set(modalres->out, 0);
+
     for (n = 0; n < blksize; n++) {
         GFFLT in, freq, q, out;
         in = gf_cable_get(modalres->in, n);
@@ -36,6 +66,12 @@ static void compute(gf_node *node)
         out = sk_modalres_tick(&modalres->modalres, in);
         gf_cable_set(modalres->out, n, out);
     }
+
+    gf_tail_hold(&modalres->tail,
+                 ring_hold(modalres->modalres.freq,
+                           modalres->modalres.q,
+                           modalres->modalres.sr));
+    gf_tail_check(&modalres->tail, gf_cable_data(modalres->out), blksize);
 }
 
 static void destroy(gf_node *node)
@@ -77,6 +113,8 @@ int sk_node_modalres(sk_core *core)
 
     sr = gf_patch_srate_get(patch);
     sk_modalres_init(&modalres->modalres, sr);
+    /* set from the frequency and Q every block */
+    gf_tail_init(&modalres->tail, 1);
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
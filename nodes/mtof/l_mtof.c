@@ -7,6 +7,7 @@
 #include "sklil.h"
 
 int sk_node_mtof(sk_core *core);
+int sk_node_kmtof(sk_core *core);
 
 static lil_value_t mtof(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -24,7 +25,24 @@ static lil_value_t mtof(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t kmtof(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kmtof", argc, 1);
+
+    rc = sklil_param(core, argv[0]);
+    SKLIL_PARAM_CHECK(lil, rc, "kmtof");
+
+    rc = sk_node_kmtof(core);
+    SKLIL_ERROR_CHECK(lil, rc, "kmtof didn't work out.");
+    return NULL;
+}
+
 void sklil_load_mtof(lil_t lil)
 {
     lil_register(lil, "mtof", mtof);
+    lil_register(lil, "kmtof", kmtof);
 }
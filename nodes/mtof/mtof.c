@@ -17,20 +17,39 @@ static void compute(gf_node *node)
     int blksize;
     int n;
     struct mtof_n *mtof;
+    gf_view nn;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     mtof = (struct mtof_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, nn;
-        nn = gf_cable_get(mtof->nn, n);
-
-        out = sk_mtof_tick(&mtof->mtof, nn);
-        gf_cable_set(mtof->out, n, out);
+    gf_cable_view(mtof->nn, &nn);
+    out = gf_cable_data(mtof->out);
+
+    if (GF_VIEW_CONSTANT(nn)) {
+        /* sk_mtof caches the last note, so this is cheap */
+        GFFLT f = sk_mtof_tick(&mtof->mtof, *nn.ptr);
+        for (n = 0; n < blksize; n++) out[n] = f;
+    } else {
+        for (n = 0; n < blksize; n++) {
+            out[n] = sk_mtof_tick(&mtof->mtof, nn.ptr[n]);
+        }
     }
 }
 
+/* control rate: one note for the whole block */
+
+static void kcompute(gf_node *node)
+{
+    struct mtof_n *mtof;
+
+    mtof = (struct mtof_n *)gf_node_get_data(node);
+
+    gf_cable_kset(mtof->out,
+                  sk_mtof_tick(&mtof->mtof, gf_cable_kget(mtof->nn)));
+}
+
 static void destroy(gf_node *node)
 {
     gf_patch *patch;
@@ -43,7 +62,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_mtof(sk_core *core)
+static int node_mtof(sk_core *core, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -69,16 +88,29 @@ int sk_node_mtof(sk_core *core)
     rc = gf_node_cables_alloc(node, 2);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 1);
+    if (krate) gf_node_set_krate(node, 1);
+    else gf_node_set_block(node, 1);
 
     gf_node_get_cable(node, 0, &mtof->nn);
     gf_node_get_cable(node, 1, &mtof->out);
 
     gf_node_set_data(node, mtof);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &nn, 0);
     sk_param_out(core, node, 1);
     return 0;
 }
+
+int sk_node_mtof(sk_core *core)
+{
+    return node_mtof(core, 0);
+}
+
+int sk_node_kmtof(sk_core *core)
+{
+    return node_mtof(core, 1);
+}
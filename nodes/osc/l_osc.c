@@ -7,6 +7,7 @@
 #include "sklil.h"
 
 int sk_node_osc(sk_core *core);
+int sk_node_kosc(sk_core *core);
 
 static lil_value_t osc(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -29,7 +30,26 @@ static lil_value_t osc(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t kosc(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kosc", argc, 4);
+
+    /* skip param 0 */
+    sklil_param(core, argv[1]);
+    sklil_param(core, argv[2]);
+    sklil_param(core, argv[3]);
+
+    rc = sk_node_kosc(core);
+    SKLIL_ERROR_CHECK(lil, rc, "kosc didn't work out.");
+    return NULL;
+}
+
 void sklil_load_osc(lil_t lil)
 {
     lil_register(lil, "osc", osc);
+    lil_register(lil, "kosc", kosc);
 }
@@ -16,24 +16,44 @@ struct osc_n {
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct osc_n *osc;
 
     blksize = gf_node_blksize(node);
 
     osc = (struct osc_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, f, a;
-        f = gf_cable_get(osc->freq, n);
-        a = gf_cable_get(osc->amp, n);
+    /* constant cables hold these for the whole block */
+    sk_osc_freq(&osc->osc, gf_cable_get(osc->freq, 0));
+    sk_osc_amp(&osc->osc, gf_cable_get(osc->amp, 0));
 
-        sk_osc_freq(&osc->osc, f);
-        sk_osc_amp(&osc->osc, a);
-        out = sk_osc_tick(&osc->osc);
+    sk_osc_compute(&osc->osc, blksize,
+                   gf_cable_data(osc->freq),
+                   gf_cable_data(osc->amp),
+                   gf_cable_data(osc->out));
+}
+
+/*
+ * Control rate, for LFOs: the table moves a block at a time,
+ * with the frequency scaled up to match. The output is where
+ * the oscillator ends up at the end of the block, which is
+ * what a ramp over the block should be heading for. The
+ * second tick reads it without moving.
+ */
+
+static void kcompute(gf_node *node)
+{
+    int blksize;
+    struct osc_n *osc;
+
+    blksize = gf_node_blksize(node);
+
+    osc = (struct osc_n *)gf_node_get_data(node);
 
-        gf_cable_set(osc->out, n, out);
-    }
+    sk_osc_freq(&osc->osc, gf_cable_kget(osc->freq) * blksize);
+    sk_osc_amp(&osc->osc, gf_cable_kget(osc->amp));
+    sk_osc_tick(&osc->osc);
+    sk_osc_freq(&osc->osc, 0);
+    gf_cable_kset(osc->out, sk_osc_tick(&osc->osc));
 }
 
 static void destroy(gf_node *node)
@@ -48,7 +68,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_osc(sk_core *core)
+static int node_osc(sk_core *core, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -91,14 +111,15 @@ int sk_node_osc(sk_core *core)
     rc = gf_node_cables_alloc(node, 3);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 2);
+    if (krate) gf_node_set_krate(node, 2);
+    else gf_node_set_block(node, 2);
 
     gf_node_get_cable(node, 0, &osc->freq);
     gf_node_get_cable(node, 1, &osc->amp);
     gf_node_get_cable(node, 2, &osc->out);
 
     gf_node_set_data(node, osc);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &freq, 0);
@@ -106,3 +127,13 @@ int sk_node_osc(sk_core *core)
     sk_param_out(core, node, 2);
     return 0;
 }
+
+int sk_node_osc(sk_core *core)
+{
+    return node_osc(core, 0);
+}
+
+int sk_node_kosc(sk_core *core)
+{
+    return node_osc(core, 1);
+}
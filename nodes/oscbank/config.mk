@@ -0,0 +1,4 @@
+OBJ+=nodes/oscbank/oscbank.o
+OBJ+=nodes/oscbank/l_oscbank.o
+SRC+=nodes/oscbank/oscbank.c
+SRC+=nodes/oscbank/l_oscbank.c
@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+int sk_node_oscbank(sk_core *core, int nvoices);
+int sk_node_oscbankt(sk_core *core);
+
+/* oscbank tab freq0 amp0 freq1 amp1 ... */
+static lil_value_t oscbank(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    size_t i;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "oscbank", argc, 3);
+
+    if ((argc - 1) % 2) {
+        lil_set_error(lil, "oscbank: needs a freq and amp for each voice.");
+        return NULL;
+    }
+
+    /* skip param 0 */
+    for (i = 1; i < argc; i++) {
+        rc = sklil_param(core, argv[i]);
+        SKLIL_PARAM_CHECK(lil, rc, "oscbank");
+    }
+
+    rc = sk_node_oscbank(core, (argc - 1) / 2);
+    SKLIL_ERROR_CHECK(lil, rc, "oscbank didn't work out.");
+    return NULL;
+}
+
+/* oscbankt tab freqs amps */
+static lil_value_t oscbankt(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "oscbankt", argc, 3);
+
+    rc = sk_node_oscbankt(core);
+    SKLIL_ERROR_CHECK(lil, rc, "oscbankt didn't work out.");
+    return NULL;
+}
+
+void sklil_load_oscbank(lil_t lil)
+{
+    lil_register(lil, "oscbank", oscbank);
+    lil_register(lil, "oscbankt", oscbankt);
+}
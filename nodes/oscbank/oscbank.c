@@ -0,0 +1,220 @@
+/*
+ * Oscillator Bank
+ *
+ * A set of oscillators reading the same wavetable, summed
+ * into one output. This is one node instead of an osc and
+ * an add for every voice.
+ *
+ * oscbank takes a frequency and an amplitude for each voice,
+ * which can be constants or cables. oscbankt takes them from
+ * two tables, which get read at the start of every block, so
+ * they can be changed while the patch runs.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "graforge.h"
+#include "core.h"
+#define SK_OSCBANK_PRIV
+#include "dsp/oscbank.h"
+
+struct oscbank_n {
+    gf_cable *freq[SK_OSCBANK_MAX];
+    gf_cable *amp[SK_OSCBANK_MAX];
+    gf_cable *out;
+    sk_table *ftab;
+    sk_table *atab;
+    sk_oscbank ob;
+};
+
+static void compute(gf_node *node)
+{
+    int blksize;
+    struct oscbank_n *ob;
+    const SKFLT *freq[SK_OSCBANK_MAX];
+    const SKFLT *amp[SK_OSCBANK_MAX];
+    int nvoices;
+    int v;
+
+    blksize = gf_node_blksize(node);
+    ob = (struct oscbank_n *)gf_node_get_data(node);
+    nvoices = sk_oscbank_nvoices(&ob->ob);
+
+    /* constant cables hold these for the whole block */
+    for (v = 0; v < nvoices; v++) {
+        sk_oscbank_freq(&ob->ob, v, gf_cable_get(ob->freq[v], 0));
+        sk_oscbank_amp(&ob->ob, v, gf_cable_get(ob->amp[v], 0));
+        freq[v] = gf_cable_data(ob->freq[v]);
+        amp[v] = gf_cable_data(ob->amp[v]);
+    }
+
+    sk_oscbank_compute(&ob->ob, blksize, freq, amp,
+                       gf_cable_data(ob->out));
+}
+
+static void tcompute(gf_node *node)
+{
+    int blksize;
+    struct oscbank_n *ob;
+    SKFLT *freq, *amp;
+    int nvoices;
+    int v;
+
+    blksize = gf_node_blksize(node);
+    ob = (struct oscbank_n *)gf_node_get_data(node);
+    nvoices = sk_oscbank_nvoices(&ob->ob);
+
+    freq = sk_table_data(ob->ftab);
+    amp = sk_table_data(ob->atab);
+
+    for (v = 0; v < nvoices; v++) {
+        sk_oscbank_freq(&ob->ob, v, freq[v]);
+        sk_oscbank_amp(&ob->ob, v, amp[v]);
+    }
+
+    sk_oscbank_compute(&ob->ob, blksize, NULL, NULL,
+                       gf_cable_data(ob->out));
+}
+
+static void destroy(gf_node *node)
+{
+    gf_patch *patch;
+    int rc;
+    void *ud;
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    ud = gf_node_get_data(node);
+    gf_memory_free(patch, &ud);
+}
+
+static int new_oscbank(sk_core *core,
+                       sk_table *wt,
+                       int nvoices,
+                       struct oscbank_n **pob)
+{
+    gf_patch *patch;
+    void *ud;
+    struct oscbank_n *ob;
+    int rc;
+
+    patch = sk_core_patch(core);
+
+    rc = gf_memory_alloc(patch, sizeof(struct oscbank_n), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    ob = (struct oscbank_n *)ud;
+
+    sk_oscbank_init(&ob->ob,
+                    gf_patch_srate_get(patch),
+                    sk_table_data(wt),
+                    sk_table_size(wt),
+                    nvoices);
+
+    ob->ftab = NULL;
+    ob->atab = NULL;
+
+    *pob = ob;
+    return 0;
+}
+
+int sk_node_oscbank(sk_core *core, int nvoices)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    sk_param freq[SK_OSCBANK_MAX];
+    sk_param amp[SK_OSCBANK_MAX];
+    struct oscbank_n *ob;
+    sk_table *wt;
+    int v;
+
+    if (nvoices < 1 || nvoices > SK_OSCBANK_MAX) return 1;
+
+    for (v = nvoices - 1; v >= 0; v--) {
+        rc = sk_param_get(core, &amp[v]);
+        SK_ERROR_CHECK(rc);
+        rc = sk_param_get(core, &freq[v]);
+        SK_ERROR_CHECK(rc);
+    }
+
+    rc = sk_core_table_pop(core, &wt);
+    SK_ERROR_CHECK(rc);
+
+    rc = new_oscbank(core, wt, nvoices, &ob);
+    SK_ERROR_CHECK(rc);
+
+    patch = sk_core_patch(core);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 2 * nvoices + 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 2 * nvoices);
+
+    for (v = 0; v < nvoices; v++) {
+        gf_node_get_cable(node, 2 * v, &ob->freq[v]);
+        gf_node_get_cable(node, 2 * v + 1, &ob->amp[v]);
+    }
+
+    gf_node_get_cable(node, 2 * nvoices, &ob->out);
+
+    gf_node_set_data(node, ob);
+    gf_node_set_compute(node, compute);
+    gf_node_set_destroy(node, destroy);
+
+    for (v = 0; v < nvoices; v++) {
+        sk_param_set(core, node, &freq[v], 2 * v);
+        sk_param_set(core, node, &amp[v], 2 * v + 1);
+    }
+
+    sk_param_out(core, node, 2 * nvoices);
+    return 0;
+}
+
+int sk_node_oscbankt(sk_core *core)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    struct oscbank_n *ob;
+    sk_table *wt, *ftab, *atab;
+    int nvoices;
+
+    rc = sk_core_table_pop(core, &atab);
+    SK_ERROR_CHECK(rc);
+    rc = sk_core_table_pop(core, &ftab);
+    SK_ERROR_CHECK(rc);
+    rc = sk_core_table_pop(core, &wt);
+    SK_ERROR_CHECK(rc);
+
+    /* one voice for each entry both tables have */
+    nvoices = sk_table_size(ftab);
+    if (sk_table_size(atab) < nvoices) nvoices = sk_table_size(atab);
+    if (nvoices > SK_OSCBANK_MAX) nvoices = SK_OSCBANK_MAX;
+
+    rc = new_oscbank(core, wt, nvoices, &ob);
+    SK_ERROR_CHECK(rc);
+
+    ob->ftab = ftab;
+    ob->atab = atab;
+
+    patch = sk_core_patch(core);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 1);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 0);
+    gf_node_get_cable(node, 0, &ob->out);
+
+    gf_node_set_data(node, ob);
+    gf_node_set_compute(node, tcompute);
+    gf_node_set_destroy(node, destroy);
+
+    sk_param_out(core, node, 0);
+    return 0;
+}
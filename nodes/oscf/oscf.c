@@ -15,43 +15,33 @@ struct oscf_n {
 static void oscf_compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct oscf_n *oscf;
 
     blksize = gf_node_blksize(node);
 
     oscf = (struct oscf_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, freq;
-        freq = gf_cable_get(oscf->freq, n);
-
-        sk_oscf_freq(&oscf->oscf, freq);
-        out = sk_oscf_tick(&oscf->oscf);
-
-        gf_cable_set(oscf->out, n, out);
-    }
+    sk_oscf_freq(&oscf->oscf, gf_cable_get(oscf->freq, 0));
+    sk_oscf_compute(&oscf->oscf, blksize,
+                    gf_cable_data(oscf->freq),
+                    gf_cable_data(oscf->out));
 }
 
 /* hijack 'freq' cable to be external phasor */
 static void oscfext_compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct oscf_n *oscf;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     oscf = (struct oscf_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, phs;
-        phs = gf_cable_get(oscf->freq, n);
-
-        out = sk_oscf_tick_extphs(&oscf->oscf, phs);
-
-        gf_cable_set(oscf->out, n, out);
-    }
+    out = gf_cable_data(oscf->out);
+    sk_oscf_compute_extphs(&oscf->oscf, blksize,
+                           gf_cable_input(oscf->freq, out, blksize),
+                           out);
 }
 
 static void destroy(gf_node *node)
@@ -0,0 +1,4 @@
+OBJ+=nodes/oversample/oversample.o
+OBJ+=nodes/oversample/l_oversample.o
+SRC+=nodes/oversample/oversample.c
+SRC+=nodes/oversample/l_oversample.c
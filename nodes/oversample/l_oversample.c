@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+int sk_node_oversample(sk_core *core,
+                       int factor,
+                       int nin,
+                       int (*body)(sk_core *, void *),
+                       void *ud);
+
+struct body {
+    lil_t lil;
+    lil_value_t code;
+};
+
+static int run_body(sk_core *core, void *ud)
+{
+    struct body *b;
+
+    b = ud;
+    lil_free_value(lil_parse_value(b->lil, b->code, 0));
+
+    return 0;
+}
+
+/* oversample factor nin {body} */
+static lil_value_t oversample(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    struct body b;
+    int rc;
+
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "oversample", argc, 3);
+
+    b.lil = lil;
+    b.code = argv[2];
+
+    rc = sk_node_oversample(core,
+                            lil_to_integer(argv[0]),
+                            lil_to_integer(argv[1]),
+                            run_body, &b);
+    SKLIL_ERROR_CHECK(lil, rc, "oversample didn't work out.");
+    return NULL;
+}
+
+void sklil_load_oversample(lil_t lil)
+{
+    lil_register(lil, "oversample", oversample);
+}
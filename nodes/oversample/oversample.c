@@ -0,0 +1,267 @@
+/*
+ * Oversample
+ *
+ * Runs part of a patch at 2, 4, or 8 times the sample rate,
+ * for things that alias badly (waveshapers, FM, hard edged
+ * oscillators).
+ *
+ * The part that gets oversampled (the body) is built by a
+ * callback, with the patch sample rate and block size
+ * temporarily multiplied. Inputs to the body are taken off
+ * the stack beforehand, and go through an upsampler node.
+ * The one output the body leaves on the stack goes through
+ * a downsampler node, and is what gets pushed in the end.
+ * Everything else stays at the normal rate.
+ *
+ * Resampling is done in stages of 2x, with half-band
+ * filters. The stage closest to the normal rate does most
+ * of the work, and uses the longest filter. Altogether,
+ * going up and back down delays the signal by 30.5
+ * samples at 2x, 35.75 at 4x, and 38.375 at 8x (see
+ * halfband.org for where these come from).
+ *
+ * The block size limit has to be big enough for the
+ * oversampled blocks (see sk_core_blkmax).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "graforge.h"
+#include "core.h"
+#define SK_HALFBAND_PRIV
+#include "dsp/halfband.h"
+
+#define MAXSTAGES 3
+#define MAXIN 8
+
+struct resampler {
+    gf_cable *in;
+    gf_cable *out;
+    int factor;
+    int nstages;
+    sk_halfband hb[MAXSTAGES];
+    GFFLT *buf;
+};
+
+/* one stage for each doubling, hb[0] is next to the normal rate */
+
+static int stages(int factor)
+{
+    switch (factor) {
+        case 2: return 1;
+        case 4: return 2;
+        case 8: return 3;
+    }
+
+    return 0;
+}
+
+/*
+ * The input is copied to the scratch buffer first, since
+ * the output block can be the same buffer as the input.
+ * Stages in the middle go back and forth between the two
+ * halves of the scratch buffer.
+ */
+
+static void up_compute(gf_node *node)
+{
+    struct resampler *r;
+    GFFLT *out;
+    GFFLT *a, *b;
+    GFFLT *src, *dst;
+    int len;
+    int s;
+
+    r = gf_node_get_data(node);
+    len = gf_node_blksize(node) / r->factor;
+    out = gf_cable_data(r->out);
+
+    a = r->buf;
+    b = r->buf + gf_node_blksize(node) / 2;
+    memcpy(a, gf_cable_input(r->in, a, len), sizeof(GFFLT) * len);
+
+    src = a;
+
+    for (s = 0; s < r->nstages; s++) {
+        dst = s == r->nstages - 1 ? out : (src == a ? b : a);
+        sk_halfband_up(&r->hb[s], src, dst, len);
+        src = dst;
+        len *= 2;
+    }
+}
+
+static void down_compute(gf_node *node)
+{
+    struct resampler *r;
+    GFFLT *out;
+    GFFLT *src, *dst;
+    int len;
+    int s;
+
+    r = gf_node_get_data(node);
+    len = gf_node_blksize(node) * r->factor;
+    out = gf_cable_data(r->out);
+
+    src = gf_cable_input(r->in, r->buf, len);
+
+    for (s = r->nstages - 1; s >= 0; s--) {
+        len /= 2;
+        dst = s == 0 ? out : r->buf;
+        sk_halfband_down(&r->hb[s], src, dst, len);
+        src = dst;
+    }
+}
+
+static void destroy(gf_node *node)
+{
+    gf_patch *patch;
+    struct resampler *r;
+    void *ud;
+    int rc;
+
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    r = gf_node_get_data(node);
+    ud = r->buf;
+    gf_memory_free(patch, &ud);
+    ud = r;
+    gf_memory_free(patch, &ud);
+}
+
+/*
+ * Makes a resampler node reading from in, using the current
+ * patch block size. The scratch buffer is big enough for
+ * the oversampled block.
+ */
+
+static int resampler(sk_core *core,
+                     sk_param *in,
+                     int factor,
+                     int up)
+{
+    gf_patch *patch;
+    gf_node *node;
+    struct resampler *r;
+    void *ud;
+    int blksize;
+    int rc;
+    int s;
+
+    patch = sk_core_patch(core);
+    blksize = gf_patch_blksize(patch);
+    if (!up) blksize *= factor;
+
+    rc = gf_memory_alloc(patch, sizeof(struct resampler), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    r = ud;
+
+    rc = gf_memory_alloc(patch, sizeof(GFFLT) * blksize, &ud);
+    SK_GF_ERROR_CHECK(rc);
+    r->buf = ud;
+
+    r->factor = factor;
+    r->nstages = stages(factor);
+
+    for (s = 0; s < r->nstages; s++) {
+        sk_halfband_init(&r->hb[s], s == 0 ? 16 : 6);
+    }
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 2);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 1);
+
+    gf_node_get_cable(node, 0, &r->in);
+    gf_node_get_cable(node, 1, &r->out);
+
+    gf_node_set_data(node, r);
+    gf_node_set_compute(node, up ? up_compute : down_compute);
+    gf_node_set_destroy(node, destroy);
+
+    rc = sk_param_set(core, node, in, 0);
+    SK_ERROR_CHECK(rc);
+    rc = sk_param_out(core, node, 1);
+    SK_ERROR_CHECK(rc);
+
+    return 0;
+}
+
+/*
+ * Pushes the inputs for the body, in the order they were
+ * on the stack. Constants don't need resampling, and are
+ * passed along as they are.
+ */
+
+static int inputs(sk_core *core, sk_param *in, int nin, int factor)
+{
+    int i;
+    int rc;
+
+    for (i = 0; i < nin; i++) {
+        if (sk_param_isconstant(&in[i])) {
+            rc = sk_core_constant(core, sk_param_constant(&in[i]));
+        } else {
+            rc = resampler(core, &in[i], factor, 1);
+        }
+        SK_ERROR_CHECK(rc);
+    }
+
+    return 0;
+}
+
+int sk_node_oversample(sk_core *core,
+                       int factor,
+                       int nin,
+                       int (*body)(sk_core *, void *),
+                       void *ud)
+{
+    gf_patch *patch;
+    sk_param in[MAXIN];
+    sk_param out;
+    int blksize;
+    int sr;
+    int pos;
+    int rc;
+    int i;
+
+    if (stages(factor) == 0) return 1;
+    if (nin < 0 || nin > MAXIN) return 1;
+
+    patch = sk_core_patch(core);
+    blksize = gf_patch_blksize(patch);
+    sr = gf_patch_srate_get(patch);
+
+    if (blksize * factor > gf_patch_maxblksize(patch)) return 1;
+
+    for (i = nin - 1; i >= 0; i--) {
+        rc = sk_param_get(core, &in[i]);
+        SK_ERROR_CHECK(rc);
+    }
+
+    gf_patch_blksize_set(patch, blksize * factor);
+    gf_patch_srate_set(patch, sr * factor);
+
+    rc = inputs(core, in, nin, factor);
+
+    if (!rc) {
+        pos = sk_core_stackpos(core);
+        rc = body(core, ud);
+        if (!rc && sk_core_stackpos(core) != pos - nin + 1) rc = 1;
+    }
+
+    if (!rc) rc = sk_param_get(core, &out);
+
+    gf_patch_blksize_set(patch, blksize);
+    gf_patch_srate_set(patch, sr);
+    SK_ERROR_CHECK(rc);
+
+    if (sk_param_isconstant(&out)) {
+        return sk_core_constant(core, sk_param_constant(&out));
+    }
+
+    return resampler(core, &out, factor, 0);
+}
@@ -18,29 +18,26 @@ struct peakeq_n {
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct peakeq_n *peakeq;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     peakeq = (struct peakeq_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, freq, bw, gain, out;
-        in = gf_cable_get(peakeq->in, n);
+    out = gf_cable_data(peakeq->out);
 
-        freq = gf_cable_get(peakeq->freq, n);
-        sk_peakeq_freq(&peakeq->peakeq, freq);
+    /* constant cables hold these for the whole block */
+    sk_peakeq_freq(&peakeq->peakeq, gf_cable_get(peakeq->freq, 0));
+    sk_peakeq_bandwidth(&peakeq->peakeq, gf_cable_get(peakeq->bw, 0));
+    sk_peakeq_gain(&peakeq->peakeq, gf_cable_get(peakeq->gain, 0));
 
-        bw = gf_cable_get(peakeq->bw, n);
-        sk_peakeq_bandwidth(&peakeq->peakeq, bw);
-
-        gain = gf_cable_get(peakeq->gain, n);
-        sk_peakeq_gain(&peakeq->peakeq, gain);
-
-        out = sk_peakeq_tick(&peakeq->peakeq, in);
-        gf_cable_set(peakeq->out, n, out);
-    }
+    sk_peakeq_compute(&peakeq->peakeq, blksize,
+                      gf_cable_data(peakeq->freq),
+                      gf_cable_data(peakeq->bw),
+                      gf_cable_data(peakeq->gain),
+                      gf_cable_input(peakeq->in, out, blksize),
+                      out);
 }
 
 static void destroy(gf_node *node)
@@ -78,6 +78,8 @@ int sk_node_phasewarp(sk_core *core)
 
     gf_node_set_data(node, phasewarp);
     gf_node_set_compute(node, compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &in, 0);
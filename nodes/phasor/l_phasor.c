@@ -8,6 +8,7 @@
 
 int sk_node_phasor(sk_core *core, SKFLT iphs);
 int sk_node_tphasor(sk_core *core, SKFLT iphs);
+int sk_node_kphasor(sk_core *core, SKFLT iphs);
 
 static lil_value_t phasor(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -36,8 +37,22 @@ static lil_value_t tphasor(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t kphasor(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kphasor", argc, 2);
+
+    sklil_param(core, argv[0]);
+
+    sk_node_kphasor(core, lil_to_double(argv[1]));
+    return NULL;
+}
+
 void sklil_load_phasor(lil_t lil)
 {
     lil_register(lil, "phasor", phasor);
     lil_register(lil, "tphasor", tphasor);
+    lil_register(lil, "kphasor", kphasor);
 }
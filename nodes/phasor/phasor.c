@@ -17,20 +17,44 @@ static void compute(gf_node *node)
     int blksize;
     int n;
     struct phasor_n *phasor;
+    gf_view freq;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     phasor = (struct phasor_n *)gf_node_get_data(node);
 
+    gf_cable_view(phasor->freq, &freq);
+    out = gf_cable_data(phasor->out);
+
     for (n = 0; n < blksize; n++) {
-        GFFLT out, f;
-        f = gf_cable_get(phasor->freq, n);
+        sk_phasor_freq(&phasor->phasor, GF_VIEW(freq, n));
+        out[n] = sk_phasor_tick(&phasor->phasor);
+    }
+}
 
-        sk_phasor_freq(&phasor->phasor, f);
-        out = sk_phasor_tick(&phasor->phasor);
+/*
+ * Control rate: the phasor moves a whole block at a time.
+ * At fast enough rates that can be more than one cycle,
+ * which the tick function doesn't wrap.
+ */
 
-        gf_cable_set(phasor->out, n, out);
-    }
+static void kcompute(gf_node *node)
+{
+    int blksize;
+    struct phasor_n *phasor;
+    SKFLT phs;
+
+    blksize = gf_node_blksize(node);
+
+    phasor = (struct phasor_n *)gf_node_get_data(node);
+
+    sk_phasor_freq(&phasor->phasor,
+                   gf_cable_kget(phasor->freq) * blksize);
+    gf_cable_kset(phasor->out, sk_phasor_tick(&phasor->phasor));
+
+    phs = phasor->phasor.phs;
+    if (phs >= 1.0 || phs < 0.0) phasor->phasor.phs = phs - floor(phs);
 }
 
 static void destroy(gf_node *node)
@@ -45,7 +69,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_phasor(sk_core *core, SKFLT iphs)
+static int node_phasor(sk_core *core, SKFLT iphs, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -73,13 +97,22 @@ int sk_node_phasor(sk_core *core, SKFLT iphs)
     rc = gf_node_cables_alloc(node, 2);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 1);
+    if (krate) {
+        /* ramping across the wrap would sweep backwards */
+        int klerp;
+        klerp = gf_patch_klerp(patch);
+        gf_patch_klerp_set(patch, 0);
+        gf_node_set_krate(node, 1);
+        gf_patch_klerp_set(patch, klerp);
+    } else {
+        gf_node_set_block(node, 1);
+    }
 
     gf_node_get_cable(node, 0, &phasor->freq);
     gf_node_get_cable(node, 1, &phasor->out);
 
     gf_node_set_data(node, phasor);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &freq, 0);
@@ -87,6 +120,16 @@ int sk_node_phasor(sk_core *core, SKFLT iphs)
     return 0;
 }
 
+int sk_node_phasor(sk_core *core, SKFLT iphs)
+{
+    return node_phasor(core, iphs, 0);
+}
+
+int sk_node_kphasor(sk_core *core, SKFLT iphs)
+{
+    return node_phasor(core, iphs, 1);
+}
+
 struct tphasor_n {
     gf_cable *reset;
     gf_cable *freq;
@@ -81,6 +81,8 @@ int sk_node_plotter(sk_core *core, const char *filename)
     gf_node_set_data(node, plotter);
     gf_node_set_compute(node, compute);
     gf_node_set_destroy(node, destroy);
+    /* writes to a file, so it always stays */
+    gf_node_set_flags(node, GF_NODE_SINK);
 
     sk_param_set(core, node, &in, 0);
     sk_param_set(core, node, &trig, 1);
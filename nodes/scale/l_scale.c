@@ -8,6 +8,8 @@
 
 int sk_node_scale(sk_core *core);
 int sk_node_biscale(sk_core *core);
+int sk_node_kscale(sk_core *core);
+int sk_node_kbiscale(sk_core *core);
 
 static lil_value_t biscale(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -39,8 +41,40 @@ static lil_value_t scale(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t kbiscale(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kbiscale", argc, 3);
+
+    sklil_param(core, argv[0]);
+    sklil_param(core, argv[1]);
+    sklil_param(core, argv[2]);
+
+    sk_node_kbiscale(core);
+    return NULL;
+}
+
+static lil_value_t kscale(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "kscale", argc, 3);
+
+    sklil_param(core, argv[0]);
+    sklil_param(core, argv[1]);
+    sklil_param(core, argv[2]);
+
+    sk_node_kscale(core);
+    return NULL;
+}
+
 void sklil_load_scale(lil_t lil)
 {
     lil_register(lil, "biscale", biscale);
     lil_register(lil, "scale", scale);
+    lil_register(lil, "kbiscale", kbiscale);
+    lil_register(lil, "kscale", kscale);
 }
@@ -17,20 +17,20 @@ static void biscale_compute(gf_node *node)
     int blksize;
     int n;
     struct scale_n *scale;
+    gf_view in, min, max;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     scale = (struct scale_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, in, min, max;
-
-        in = gf_cable_get(scale->in, n);
-        min = gf_cable_get(scale->min, n);
-        max = gf_cable_get(scale->max, n);
-        out = sk_biscale(in, min, max);
+    gf_cable_view(scale->in, &in);
+    gf_cable_view(scale->min, &min);
+    gf_cable_view(scale->max, &max);
+    out = gf_cable_data(scale->out);
 
-        gf_cable_set(scale->out, n, out);
+    for (n = 0; n < blksize; n++) {
+        out[n] = sk_biscale(GF_VIEW(in, n), GF_VIEW(min, n), GF_VIEW(max, n));
     }
 }
 
@@ -39,21 +39,45 @@ static void scale_compute(gf_node *node)
     int blksize;
     int n;
     struct scale_n *scale;
+    gf_view in, min, max;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     scale = (struct scale_n *)gf_node_get_data(node);
 
+    gf_cable_view(scale->in, &in);
+    gf_cable_view(scale->min, &min);
+    gf_cable_view(scale->max, &max);
+    out = gf_cable_data(scale->out);
+
     for (n = 0; n < blksize; n++) {
-        GFFLT out, in, min, max;
+        out[n] = sk_scale(GF_VIEW(in, n), GF_VIEW(min, n), GF_VIEW(max, n));
+    }
+}
 
-        in = gf_cable_get(scale->in, n);
-        min = gf_cable_get(scale->min, n);
-        max = gf_cable_get(scale->max, n);
-        out = sk_scale(in, min, max);
+static void kscale_compute(gf_node *node)
+{
+    struct scale_n *scale;
 
-        gf_cable_set(scale->out, n, out);
-    }
+    scale = (struct scale_n *)gf_node_get_data(node);
+
+    gf_cable_kset(scale->out,
+                  sk_scale(gf_cable_kget(scale->in),
+                           gf_cable_kget(scale->min),
+                           gf_cable_kget(scale->max)));
+}
+
+static void kbiscale_compute(gf_node *node)
+{
+    struct scale_n *scale;
+
+    scale = (struct scale_n *)gf_node_get_data(node);
+
+    gf_cable_kset(scale->out,
+                  sk_biscale(gf_cable_kget(scale->in),
+                             gf_cable_kget(scale->min),
+                             gf_cable_kget(scale->max)));
 }
 
 static void destroy(gf_node *node)
@@ -68,7 +92,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-static int node_scale(sk_core *core, gf_function compute)
+static int node_scale(sk_core *core, gf_function compute, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -98,7 +122,8 @@ static int node_scale(sk_core *core, gf_function compute)
     rc = gf_node_cables_alloc(node, 4);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 3);
+    if (krate) gf_node_set_krate(node, 3);
+    else gf_node_set_block(node, 3);
 
     gf_node_get_cable(node, 0, &scale->in);
     gf_node_get_cable(node, 1, &scale->min);
@@ -107,6 +132,8 @@ static int node_scale(sk_core *core, gf_function compute)
 
     gf_node_set_data(node, scale);
     gf_node_set_compute(node, compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &in, 0);
@@ -118,10 +145,20 @@ static int node_scale(sk_core *core, gf_function compute)
 
 int sk_node_biscale(sk_core *core)
 {
-    return node_scale(core, biscale_compute);
+    return node_scale(core, biscale_compute, 0);
 }
 
 int sk_node_scale(sk_core *core)
 {
-    return node_scale(core, scale_compute);
+    return node_scale(core, scale_compute, 0);
+}
+
+int sk_node_kbiscale(sk_core *core)
+{
+    return node_scale(core, kbiscale_compute, 1);
+}
+
+int sk_node_kscale(sk_core *core)
+{
+    return node_scale(core, kscale_compute, 1);
 }
@@ -7,6 +7,7 @@
 #include "sklil.h"
 
 int sk_node_sine(sk_core *core);
+int sk_node_ksine(sk_core *core);
 
 static lil_value_t sine(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -22,7 +23,22 @@ static lil_value_t sine(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t ksine(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "ksine", argc, 2);
+
+    sklil_param(core, argv[0]);
+    sklil_param(core, argv[1]);
+
+    sk_node_ksine(core);
+    return NULL;
+}
+
 void sklil_load_sine(lil_t lil)
 {
     lil_register(lil, "sine", sine);
+    lil_register(lil, "ksine", ksine);
 }
@@ -33,24 +33,44 @@ static void gen_sine(SKFLT *tab, int sz)
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct sine_n *sine;
 
     blksize = gf_node_blksize(node);
 
     sine = (struct sine_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT out, f, a;
-        f = gf_cable_get(sine->freq, n);
-        a = gf_cable_get(sine->amp, n);
+    /* constant cables hold these for the whole block */
+    sk_osc_freq(&sine->osc, gf_cable_get(sine->freq, 0));
+    sk_osc_amp(&sine->osc, gf_cable_get(sine->amp, 0));
 
-        sk_osc_freq(&sine->osc, f);
-        sk_osc_amp(&sine->osc, a);
-        out = sk_osc_tick(&sine->osc);
+    sk_osc_compute(&sine->osc, blksize,
+                   gf_cable_data(sine->freq),
+                   gf_cable_data(sine->amp),
+                   gf_cable_data(sine->out));
+}
 
-        gf_cable_set(sine->out, n, out);
-    }
+/*
+ * Control rate, for LFOs: the table moves a block at a time,
+ * with the frequency scaled up to match. The output is where
+ * the oscillator ends up at the end of the block, which is
+ * what a ramp over the block should be heading for. The
+ * second tick reads it without moving.
+ */
+
+static void kcompute(gf_node *node)
+{
+    int blksize;
+    struct sine_n *sine;
+
+    blksize = gf_node_blksize(node);
+
+    sine = (struct sine_n *)gf_node_get_data(node);
+
+    sk_osc_freq(&sine->osc, gf_cable_kget(sine->freq) * blksize);
+    sk_osc_amp(&sine->osc, gf_cable_kget(sine->amp));
+    sk_osc_tick(&sine->osc);
+    sk_osc_freq(&sine->osc, 0);
+    gf_cable_kset(sine->out, sk_osc_tick(&sine->osc));
 }
 
 static void destroy(gf_node *node)
@@ -65,7 +85,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_sine(sk_core *core)
+static int node_sine(sk_core *core, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -93,14 +113,15 @@ int sk_node_sine(sk_core *core)
     rc = gf_node_cables_alloc(node, 3);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 2);
+    if (krate) gf_node_set_krate(node, 2);
+    else gf_node_set_block(node, 2);
 
     gf_node_get_cable(node, 0, &sine->freq);
     gf_node_get_cable(node, 1, &sine->amp);
     gf_node_get_cable(node, 2, &sine->out);
 
     gf_node_set_data(node, sine);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
     gf_node_set_destroy(node, destroy);
 
     sr = gf_patch_srate_get(patch);
@@ -112,3 +133,13 @@ int sk_node_sine(sk_core *core)
     sk_param_out(core, node, 2);
     return 0;
 }
+
+int sk_node_sine(sk_core *core)
+{
+    return node_sine(core, 0);
+}
+
+int sk_node_ksine(sk_core *core)
+{
+    return node_sine(core, 1);
+}
@@ -9,7 +9,7 @@ if (ARGC < NARGS) { \
 #define SKLIL_ERROR_CHECK(lil, rc, msg) \
 if (rc) { \
     lil_set_error(lil, msg); \
-    lil_set_errcode(rc); \
+    lil_set_errcode(lil, rc); \
     return NULL; \
 }
 
@@ -26,5 +26,19 @@ void sklil_loader(lil_t lil);
 void sklil_loader_withextra(lil_t lil);
 void sklil_clean(lil_t lil);
 int sklil_main(int argc, char *argv[]);
-void lil_set_errcode(int err);
+
+typedef struct {
+    const char *script;
+    int argc;
+    char **argv;
+    int rc;
+} sklil_job;
+
+int sklil_batch(sklil_job *jobs, int njobs, int nthreads,
+                const char *prelude,
+                void (*loader)(lil_t),
+                void (*clean)(lil_t));
+int sklil_batch_main(int argc, char *argv[],
+                     void (*loader)(lil_t),
+                     void (*clean)(lil_t));
 #endif
@@ -2,17 +2,22 @@
 #define SK_NODES_H
 int sk_node_biscale(sk_core *core);
 int sk_node_scale(sk_core *core);
+int sk_node_kbiscale(sk_core *core);
+int sk_node_kscale(sk_core *core);
 int sk_node_wavout(sk_core *core, const char *filename);
 int sk_node_wavouts(sk_core *core, const char *filename);
 int sk_node_wavin(sk_core *core, const char *filename);
 int sk_node_sine(sk_core *core);
+int sk_node_ksine(sk_core *core);
 int sk_node_dcblocker(sk_core *core);
 int sk_node_rephasor(sk_core *core);
 int sk_node_phsdiv(sk_core *core);
 int sk_node_phsmul(sk_core *core);
 int sk_node_fmpair(sk_core *core);
 int sk_node_osc(sk_core *core);
+int sk_node_kosc(sk_core *core);
 int sk_node_phasor(sk_core *core, SKFLT iphs);
+int sk_node_kphasor(sk_core *core, SKFLT iphs);
 int sk_node_add(sk_core *core);
 int sk_node_mul(sk_core *core);
 int sk_node_sub(sk_core *core);
@@ -21,6 +26,7 @@ int sk_node_bigverb(sk_core *core);
 int sk_node_gensine(sk_core *core);
 int sk_node_smoother(sk_core *core);
 int sk_node_tsmoother(sk_core *core);
+int sk_node_ksmoother(sk_core *core);
 int sk_node_metro(sk_core *core);
 int sk_node_expon(sk_core *core);
 int sk_node_rline(sk_core *core);
@@ -47,6 +53,7 @@ int sk_node_blsaw(sk_core *core);
 int sk_node_blsquare(sk_core *core);
 int sk_node_bltri(sk_core *core);
 int sk_node_mtof(sk_core *core);
+int sk_node_kmtof(sk_core *core);
 int sk_node_phsclk(sk_core *core);
 int sk_node_clkphs(sk_core *core);
 int sk_node_noise(sk_core *core);
@@ -58,6 +65,7 @@ int sk_tab_sinesum(sk_core *core, const char *argstr);
 int sk_tab_vals(sk_core *core, const char *argstr);
 int sk_node_thresh(sk_core *core);
 int sk_node_adsr(sk_core *core);
+int sk_node_kadsr(sk_core *core);
 int sk_node_tenv(sk_core *core);
 int sk_node_tick(sk_core *core);
 int sk_node_tgate(sk_core *core);
@@ -69,4 +77,16 @@ int sk_node_tdiv(sk_core *core);
 int sk_node_lowshelf(sk_core *core);
 int sk_node_highshelf(sk_core *core);
 int sk_node_envar(sk_core *core);
+int sk_node_oversample(sk_core *core,
+                       int factor,
+                       int nin,
+                       int (*body)(sk_core *, void *),
+                       void *ud);
+int sk_node_oscbank(sk_core *core, int nvoices);
+int sk_node_oscbankt(sk_core *core);
+int sk_node_butlpn(sk_core *core);
+int sk_node_buthpn(sk_core *core);
+int sk_node_eqstack(sk_core *core);
+int sk_node_modalbank(sk_core *core);
+int sk_node_ensemble(sk_core *core);
 #endif
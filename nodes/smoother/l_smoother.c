@@ -8,6 +8,7 @@
 
 int sk_node_smoother(sk_core *core);
 int sk_node_tsmoother(sk_core *core);
+int sk_node_ksmoother(sk_core *core);
 
 static lil_value_t smoother(lil_t lil, size_t argc, lil_value_t *argv)
 {
@@ -27,6 +28,24 @@ static lil_value_t smoother(lil_t lil, size_t argc, lil_value_t *argv)
     return NULL;
 }
 
+static lil_value_t ksmoother(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "ksmoother", argc, 2);
+
+    rc = sklil_param(core, argv[0]);
+    SKLIL_PARAM_CHECK(lil, rc, "ksmoother");
+    rc = sklil_param(core, argv[1]);
+    SKLIL_PARAM_CHECK(lil, rc, "ksmoother");
+
+    rc = sk_node_ksmoother(core);
+    SKLIL_ERROR_CHECK(lil, rc, "ksmoother didn't work out.");
+    return NULL;
+}
+
 static lil_value_t tsmoother(lil_t lil, size_t argc, lil_value_t *argv)
 {
     sk_core *core;
@@ -51,4 +70,5 @@ void sklil_load_smoother(lil_t lil)
 {
     lil_register(lil, "smoother", smoother);
     lil_register(lil, "tsmoother", tsmoother);
+    lil_register(lil, "ksmoother", ksmoother);
 }
@@ -63,6 +63,29 @@ static void compute_withtrig(gf_node *node)
     }
 }
 
+/*
+ * Control rate: one tick covers the whole block. With the
+ * input held over the block, dividing the smoothing time by
+ * the block length lands the filter in the same place.
+ */
+
+static void kcompute(gf_node *node)
+{
+    int blksize;
+    struct smoother_n *smoother;
+    GFFLT out;
+
+    blksize = gf_node_blksize(node);
+
+    smoother = (struct smoother_n *)gf_node_get_data(node);
+
+    sk_smoother_time(&smoother->smoother,
+                     gf_cable_kget(smoother->smooth) / blksize);
+    out = sk_smoother_tick(&smoother->smoother,
+                           gf_cable_kget(smoother->in));
+    gf_cable_kset(smoother->out, out);
+}
+
 static void destroy(gf_node *node)
 {
     gf_patch *patch;
@@ -75,7 +98,7 @@ static void destroy(gf_node *node)
     gf_memory_free(patch, &ud);
 }
 
-int sk_node_smoother(sk_core *core)
+static int node_smoother(sk_core *core, int krate)
 {
     gf_patch *patch;
     gf_node *node;
@@ -107,14 +130,15 @@ int sk_node_smoother(sk_core *core)
     rc = gf_node_cables_alloc(node, 3);
     SK_GF_ERROR_CHECK(rc);
 
-    gf_node_set_block(node, 2);
+    if (krate) gf_node_set_krate(node, 2);
+    else gf_node_set_block(node, 2);
 
     gf_node_get_cable(node, 0, &smoother->in);
     gf_node_get_cable(node, 1, &smoother->smooth);
     gf_node_get_cable(node, 2, &smoother->out);
 
     gf_node_set_data(node, smoother);
-    gf_node_set_compute(node, compute);
+    gf_node_set_compute(node, krate ? kcompute : compute);
     gf_node_set_destroy(node, destroy);
 
     sk_param_set(core, node, &in, 0);
@@ -123,6 +147,16 @@ int sk_node_smoother(sk_core *core)
     return 0;
 }
 
+int sk_node_smoother(sk_core *core)
+{
+    return node_smoother(core, 0);
+}
+
+int sk_node_ksmoother(sk_core *core)
+{
+    return node_smoother(core, 1);
+}
+
 int sk_node_tsmoother(sk_core *core)
 {
     gf_patch *patch;
@@ -13,18 +13,19 @@ static void compute(gf_node *node)
     int blksize;
     int n;
     struct softclip_n *softclip;
+    gf_view in, drive;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     softclip = (struct softclip_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, drive, out;
-        drive = gf_cable_get(softclip->drive, n);
-        in = gf_cable_get(softclip->in, n);
+    gf_cable_view(softclip->in, &in);
+    gf_cable_view(softclip->drive, &drive);
+    out = gf_cable_data(softclip->out);
 
-        out = sk_softclip_tick(in, drive);
-        gf_cable_set(softclip->out, n, out);
+    for (n = 0; n < blksize; n++) {
+        out[n] = sk_softclip_tick(GF_VIEW(in, n), GF_VIEW(drive, n));
     }
 }
 
@@ -68,6 +69,8 @@ int gf_node_softclip(gf_node *node)
 
     gf_node_set_data(node, softclip);
     gf_node_set_compute(node, compute);
+    /* output only depends on the inputs */
+    gf_node_set_flags(node, GF_NODE_STATELESS);
     gf_node_set_destroy(node, destroy);
 
     return GF_OK;
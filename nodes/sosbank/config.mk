@@ -0,0 +1,4 @@
+OBJ+=nodes/sosbank/sosbank.o
+OBJ+=nodes/sosbank/l_sosbank.o
+SRC+=nodes/sosbank/sosbank.c
+SRC+=nodes/sosbank/l_sosbank.c
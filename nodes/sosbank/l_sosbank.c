@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "lil/lil.h"
+#include "graforge.h"
+#include "core.h"
+#include "sklil.h"
+
+int sk_node_butlpn(sk_core *core);
+int sk_node_buthpn(sk_core *core);
+int sk_node_eqstack(sk_core *core);
+
+/* butlpn in freq order */
+static lil_value_t butlpn(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    int i;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "butlpn", argc, 3);
+
+    for (i = 0; i < 3; i++) {
+        rc = sklil_param(core, argv[i]);
+        SKLIL_PARAM_CHECK(lil, rc, "butlpn");
+    }
+
+    rc = sk_node_butlpn(core);
+    SKLIL_ERROR_CHECK(lil, rc, "butlpn didn't work out.");
+    return NULL;
+}
+
+/* buthpn in freq order */
+static lil_value_t buthpn(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    int i;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "buthpn", argc, 3);
+
+    for (i = 0; i < 3; i++) {
+        rc = sklil_param(core, argv[i]);
+        SKLIL_PARAM_CHECK(lil, rc, "buthpn");
+    }
+
+    rc = sk_node_buthpn(core);
+    SKLIL_ERROR_CHECK(lil, rc, "buthpn didn't work out.");
+    return NULL;
+}
+
+/* eqstack tab in */
+static lil_value_t eqstack(lil_t lil, size_t argc, lil_value_t *argv)
+{
+    sk_core *core;
+    int rc;
+    core = lil_get_data(lil);
+
+    SKLIL_ARITY_CHECK(lil, "eqstack", argc, 2);
+
+    rc = sklil_param(core, argv[1]);
+    SKLIL_PARAM_CHECK(lil, rc, "eqstack");
+
+    rc = sk_node_eqstack(core);
+    SKLIL_ERROR_CHECK(lil, rc, "eqstack didn't work out.");
+    return NULL;
+}
+
+void sklil_load_sosbank(lil_t lil)
+{
+    lil_register(lil, "butlpn", butlpn);
+    lil_register(lil, "buthpn", buthpn);
+    lil_register(lil, "eqstack", eqstack);
+}
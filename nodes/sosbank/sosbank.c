@@ -0,0 +1,292 @@
+/*
+ * SOS Bank
+ *
+ * Filters made of a cascade of second-order sections, run
+ * by one sosbank.
+ *
+ * butlpn and buthpn are Butterworth lowpass and highpass
+ * filters of any order. When freq and order are constant or
+ * control rate, the sections run a block at a time;
+ * otherwise the coefficients follow them every sample.
+ *
+ * eqstack is a parametric EQ, with one band per section, set
+ * up from a table. The table holds 4 values for each band:
+ * the type (0 for a peak, 1 for a low shelf, 2 for a high
+ * shelf), the frequency, the width (bandwidth in Hz for a
+ * peak, slope for a shelf), and the gain in dB. It gets read at the start of every block, and
+ * only the bands that changed are worked out again.
+ */
+
+#include <stdlib.h>
+#include "graforge.h"
+#include "core.h"
+#define SK_SOSBANK_PRIV
+#include "dsp/sosbank.h"
+
+enum {
+    EQ_PEAK,
+    EQ_LOWSHELF,
+    EQ_HIGHSHELF
+};
+
+struct sosbank_n {
+    gf_cable *in;
+    gf_cable *freq;
+    gf_cable *order;
+    gf_cable *out;
+    sk_table *tab;
+    int hp;
+    SKFLT pfreq;
+    int porder;
+    SKFLT band[SK_SOSBANK_MAX][4];
+    sk_sosbank sb;
+};
+
+static int control_rate(gf_cable *c)
+{
+    return gf_cable_is_constant(c) || gf_cable_is_krate(c);
+}
+
+static void butcoefs(struct sosbank_n *sn, SKFLT freq, int order)
+{
+    if (order < 1) order = 1;
+    if (order > 2 * SK_SOSBANK_MAX) order = 2 * SK_SOSBANK_MAX;
+
+    if (freq == sn->pfreq && order == sn->porder) return;
+
+    if (sn->hp) sk_sosbank_buthp(&sn->sb, order, freq);
+    else sk_sosbank_butlp(&sn->sb, order, freq);
+    sn->pfreq = freq;
+    sn->porder = order;
+}
+
+static void butcompute(gf_node *node)
+{
+    int blksize;
+    int n;
+    struct sosbank_n *sn;
+    GFFLT *out;
+
+    blksize = gf_node_blksize(node);
+    sn = (struct sosbank_n *)gf_node_get_data(node);
+
+    /* nothing changes within the block, so run it a block at a time */
+    if (control_rate(sn->freq) && control_rate(sn->order)) {
+        out = gf_cable_data(sn->out);
+        butcoefs(sn,
+                 gf_cable_kget(sn->freq),
+                 gf_cable_kget(sn->order));
+        sk_sosbank_compute(&sn->sb, blksize,
+                           gf_cable_input(sn->in, out, blksize),
+                           out);
+        return;
+    }
+
+    for (n = 0; n < blksize; n++) {
+        GFFLT in, out;
+
+        in = gf_cable_get(sn->in, n);
+        butcoefs(sn,
+                 gf_cable_get(sn->freq, n),
+                 gf_cable_get(sn->order, n));
+        out = sk_sosbank_tick(&sn->sb, in);
+        gf_cable_set(sn->out, n, out);
+    }
+}
+
+static void eqband(sk_sosbank *sb, int s, SKFLT *b)
+{
+    switch ((int)b[0]) {
+        case EQ_LOWSHELF:
+            sk_sosbank_lowshelf(sb, s, b[1], b[3], b[2]);
+            break;
+        case EQ_HIGHSHELF:
+            sk_sosbank_highshelf(sb, s, b[1], b[3], b[2]);
+            break;
+        default:
+            sk_sosbank_peak(sb, s, b[1], b[2], b[3]);
+            break;
+    }
+}
+
+static void eqcompute(gf_node *node)
+{
+    int blksize;
+    struct sosbank_n *sn;
+    GFFLT *out;
+    SKFLT *tab;
+    int s, i;
+    int changed;
+
+    blksize = gf_node_blksize(node);
+    sn = (struct sosbank_n *)gf_node_get_data(node);
+    out = gf_cable_data(sn->out);
+    tab = sk_table_data(sn->tab);
+
+    for (s = 0; s < sn->sb.nsections; s++) {
+        changed = 0;
+
+        for (i = 0; i < 4; i++) {
+            if (tab[4*s + i] != sn->band[s][i]) {
+                sn->band[s][i] = tab[4*s + i];
+                changed = 1;
+            }
+        }
+
+        if (changed) eqband(&sn->sb, s, sn->band[s]);
+    }
+
+    sk_sosbank_compute(&sn->sb, blksize,
+                       gf_cable_input(sn->in, out, blksize),
+                       out);
+}
+
+static void destroy(gf_node *node)
+{
+    gf_patch *patch;
+    int rc;
+    void *ud;
+    rc = gf_node_get_patch(node, &patch);
+    if (rc != GF_OK) return;
+    gf_node_cables_free(node);
+    ud = gf_node_get_data(node);
+    gf_memory_free(patch, &ud);
+}
+
+static int new_sosbank(sk_core *core, struct sosbank_n **psn)
+{
+    gf_patch *patch;
+    void *ud;
+    struct sosbank_n *sn;
+    int rc;
+
+    patch = sk_core_patch(core);
+
+    rc = gf_memory_alloc(patch, sizeof(struct sosbank_n), &ud);
+    SK_GF_ERROR_CHECK(rc);
+    sn = (struct sosbank_n *)ud;
+
+    sk_sosbank_init(&sn->sb, gf_patch_srate_get(patch));
+
+    sn->tab = NULL;
+    sn->hp = 0;
+    sn->pfreq = -1;
+    sn->porder = -1;
+
+    *psn = sn;
+    return 0;
+}
+
+static int butnode(sk_core *core, int hp)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    sk_param in, freq, order;
+    struct sosbank_n *sn;
+
+    rc = sk_param_get(core, &order);
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_param_get(core, &freq);
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_param_get(core, &in);
+    SK_ERROR_CHECK(rc);
+
+    rc = new_sosbank(core, &sn);
+    SK_ERROR_CHECK(rc);
+
+    sn->hp = hp;
+
+    patch = sk_core_patch(core);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 4);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 3);
+
+    gf_node_get_cable(node, 0, &sn->in);
+    gf_node_get_cable(node, 1, &sn->freq);
+    gf_node_get_cable(node, 2, &sn->order);
+    gf_node_get_cable(node, 3, &sn->out);
+
+    gf_node_set_data(node, sn);
+    gf_node_set_compute(node, butcompute);
+    gf_node_set_destroy(node, destroy);
+
+    sk_param_set(core, node, &in, 0);
+    sk_param_set(core, node, &freq, 1);
+    sk_param_set(core, node, &order, 2);
+    sk_param_out(core, node, 3);
+    return 0;
+}
+
+int sk_node_butlpn(sk_core *core)
+{
+    return butnode(core, 0);
+}
+
+int sk_node_buthpn(sk_core *core)
+{
+    return butnode(core, 1);
+}
+
+int sk_node_eqstack(sk_core *core)
+{
+    gf_patch *patch;
+    gf_node *node;
+    int rc;
+    sk_param in;
+    sk_table *tab;
+    struct sosbank_n *sn;
+    int nbands;
+    int s, i;
+
+    rc = sk_param_get(core, &in);
+    SK_ERROR_CHECK(rc);
+
+    rc = sk_core_table_pop(core, &tab);
+    SK_ERROR_CHECK(rc);
+
+    nbands = sk_table_size(tab) / 4;
+    if (nbands > SK_SOSBANK_MAX) nbands = SK_SOSBANK_MAX;
+
+    rc = new_sosbank(core, &sn);
+    SK_ERROR_CHECK(rc);
+
+    sn->tab = tab;
+    sk_sosbank_nsections(&sn->sb, nbands);
+
+    /* work out every band once, so none have to wait */
+    for (s = 0; s < nbands; s++) {
+        for (i = 0; i < 4; i++) {
+            sn->band[s][i] = sk_table_data(tab)[4*s + i];
+        }
+        eqband(&sn->sb, s, sn->band[s]);
+    }
+
+    patch = sk_core_patch(core);
+
+    rc = gf_patch_new_node(patch, &node);
+    SK_GF_ERROR_CHECK(rc);
+
+    rc = gf_node_cables_alloc(node, 2);
+    SK_GF_ERROR_CHECK(rc);
+
+    gf_node_set_block(node, 1);
+
+    gf_node_get_cable(node, 0, &sn->in);
+    gf_node_get_cable(node, 1, &sn->out);
+
+    gf_node_set_data(node, sn);
+    gf_node_set_compute(node, eqcompute);
+    gf_node_set_destroy(node, destroy);
+
+    sk_param_set(core, node, &in, 0);
+    sk_param_out(core, node, 1);
+    return 0;
+}
@@ -32,6 +32,8 @@ static void compute(gf_node *node)
         out = sk_tgate_tick(&tgate->tgate, trig);
         gf_cable_set(tgate->out, n, out);
     }
+
+    gf_cable_silent_update(tgate->out);
 }
 
 static void destroy(gf_node *node)
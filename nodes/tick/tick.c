@@ -25,6 +25,8 @@ static void compute(gf_node *node)
         if (tick->tick) tick->tick = 0;
         gf_cable_set(tick->out, n, out);
     }
+
+    gf_cable_silent_update(tick->out);
 }
 
 static void destroy(gf_node *node)
@@ -14,20 +14,51 @@ struct tract_n {
     gf_cable *velum;
     gf_cable *out;
     sk_tract *tract;
+    SKFLT ptx, pty;
 };
 
 sk_tract * sk_node_tractnew(sk_core *core);
 
+static int control_rate(gf_cable *c)
+{
+    return gf_cable_is_constant(c) || gf_cable_is_krate(c);
+}
+
+static void tongue(struct tract_n *tract, SKFLT x, SKFLT y)
+{
+    /* the tongue is the only thing that moves the diameters */
+    if (x == tract->ptx && y == tract->pty) return;
+    sk_tract_tongue_shape(tract->tract, x, y);
+    tract->ptx = x;
+    tract->pty = y;
+}
+
 static void computexy(gf_node *node)
 {
     int blksize;
     int n;
     struct tract_n *tract;
+    GFFLT *buf;
 
     blksize = gf_node_blksize(node);
 
     tract = (struct tract_n *)gf_node_get_data(node);
 
+    /* nothing changes within the block, so run it at control rate */
+    if (control_rate(tract->tongue_x) &&
+        control_rate(tract->tongue_y) &&
+        control_rate(tract->velum)) {
+        buf = gf_cable_data(tract->out);
+        tongue(tract,
+               gf_cable_kget(tract->tongue_x),
+               gf_cable_kget(tract->tongue_y));
+        sk_tract_velum(tract->tract, gf_cable_kget(tract->velum));
+        sk_tract_compute(tract->tract, blksize,
+                         gf_cable_input(tract->in, buf, blksize),
+                         buf);
+        return;
+    }
+
     for (n = 0; n < blksize; n++) {
         GFFLT in, tongue_x, tongue_y, velum, out;
 
@@ -36,7 +67,7 @@ static void computexy(gf_node *node)
         tongue_y = gf_cable_get(tract->tongue_y, n);
         velum = gf_cable_get(tract->velum, n);
 
-        sk_tract_tongue_shape(tract->tract, tongue_x, tongue_y);
+        tongue(tract, tongue_x, tongue_y);
         sk_tract_velum(tract->tract, velum);
 
         out = sk_tract_tick(tract->tract, in);
@@ -108,6 +139,8 @@ static int tractxy_node(sk_core *core, int use_velum)
     tract = (struct tract_n *)ud;
 
     tract->tract = sk_node_tractnew(core);
+    tract->ptx = -1;
+    tract->pty = -1;
 
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
@@ -13,29 +13,40 @@ struct vardelay_n {
     gf_cable *out;
     sk_vardelay vardelay;
     SKFLT *buf;
+    gf_tail tail;
 };
 
 static void compute(gf_node *node)
 {
     int blksize;
-    int n;
     struct vardelay_n *vardelay;
+    GFFLT *out;
 
     blksize = gf_node_blksize(node);
 
     vardelay = (struct vardelay_n *)gf_node_get_data(node);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, delay, feedback, out;
-        in = gf_cable_get(vardelay->in, n);
-        feedback = gf_cable_get(vardelay->feedback, n);
-        sk_vardelay_feedback(&vardelay->vardelay, feedback);
-        delay = gf_cable_get(vardelay->delay, n);
-        sk_vardelay_delay(&vardelay->vardelay, delay);
+    out = gf_cable_data(vardelay->out);
 
-        out = sk_vardelay_tick(&vardelay->vardelay, in);
-        gf_cable_set(vardelay->out, n, out);
+    if (gf_tail_skip(&vardelay->tail, gf_cable_silent(vardelay->in), blksize)) {
+        gf_cable_silence(vardelay->out);
+        return;
     }
+    gf_cable_silent_set(vardelay->out, 0);
+
+    /* constant cables hold these for the whole block */
+    sk_vardelay_feedback(&vardelay->vardelay,
+                         gf_cable_get(vardelay->feedback, 0));
+    sk_vardelay_delay(&vardelay->vardelay,
+                      gf_cable_get(vardelay->delay, 0));
+
+    sk_vardelay_compute(&vardelay->vardelay, blksize,
+                        gf_cable_data(vardelay->delay),
+                        gf_cable_data(vardelay->feedback),
+                        gf_cable_input(vardelay->in, out, blksize),
+                        out);
+
+    gf_tail_check(&vardelay->tail, out, blksize);
 }
 
 static void destroy(gf_node *node)
@@ -98,6 +109,9 @@ int sk_node_vardelay(sk_core *core)
     sk_vardelay_init(&vardelay->vardelay, sr,
                      vardelay->buf, sz);
 
+    /* wait for the whole delay line to go quiet */
+    gf_tail_init(&vardelay->tail, sz);
+
     rc = gf_patch_new_node(patch, &node);
     SK_GF_ERROR_CHECK(rc);
 
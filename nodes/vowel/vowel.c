@@ -16,16 +16,35 @@ struct vowelmorph_n {
     sk_vowel_formant tmp[5];
 };
 
+static int control_rate(gf_cable *c)
+{
+    return gf_cable_is_constant(c) || gf_cable_is_krate(c);
+}
+
 static void compute(gf_node *node)
 {
     int blksize;
     int n;
     struct vowelmorph_n *vowelmorph;
+    GFFLT *buf;
 
     blksize = gf_node_blksize(node);
 
     vowelmorph = (struct vowelmorph_n *)gf_node_get_data(node);
 
+    /* the phoneme holds for the block, so morph once */
+    if (control_rate(vowelmorph->pos) && control_rate(vowelmorph->voice)) {
+        buf = gf_cable_data(vowelmorph->out);
+        sk_vowel_morph(vowelmorph->phoneme, vowelmorph->tmp, 5,
+                       gf_cable_kget(vowelmorph->pos),
+                       gf_cable_kget(vowelmorph->voice));
+        sk_vowel_set_phoneme(&vowelmorph->vowel, vowelmorph->phoneme, 5);
+        sk_vowel_compute(&vowelmorph->vowel, blksize,
+                         gf_cable_input(vowelmorph->in, buf, blksize),
+                         buf);
+        return;
+    }
+
     for (n = 0; n < blksize; n++) {
         GFFLT in, pos, voice, out;
         in = gf_cable_get(vowelmorph->in, n);
@@ -136,21 +155,20 @@ struct vowel_n {
 static void compute_vowel(gf_node *node)
 {
     int blksize;
-    int n;
     struct vowel_n *vd;
     sk_vowel_withphoneme *vow;
+    GFFLT *buf;
 
     vd = (struct vowel_n *)gf_node_get_data(node);
     vow = vd->vowel;
     blksize = gf_node_blksize(node);
+    buf = gf_cable_data(vd->out);
 
-    for (n = 0; n < blksize; n++) {
-        GFFLT in, out;
-        in = gf_cable_get(vd->in, n);
-        sk_vowel_set_phoneme(&vow->vowel, vow->phoneme, 5);
-        out = sk_vowel_tick(&vow->vowel, in);
-        gf_cable_set(vd->out, n, out);
-    }
+    /* the phoneme only changes between blocks */
+    sk_vowel_set_phoneme(&vow->vowel, vow->phoneme, 5);
+    sk_vowel_compute(&vow->vowel, blksize,
+                     gf_cable_input(vd->in, buf, blksize),
+                     buf);
 }
 
 int gf_node_vowel(gf_node *node, sk_vowel_withphoneme *vow)
@@ -127,6 +127,8 @@ int sk_node_wavout(sk_core *core, const char *filename)
     gf_node_set_data(node, wavout);
     gf_node_set_compute(node, compute);
     gf_node_set_destroy(node, destroy);
+    /* writes to a file, so it always stays */
+    gf_node_set_flags(node, GF_NODE_SINK);
 
     sk_param_set(core, node, &in, 0);
     return 0;
@@ -176,6 +178,8 @@ int sk_node_wavouts(sk_core *core, const char *filename)
     gf_node_set_data(node, wavout);
     gf_node_set_compute(node, s_compute);
     gf_node_set_destroy(node, destroy);
+    /* writes to a file, so it always stays */
+    gf_node_set_flags(node, GF_NODE_SINK);
 
     sk_param_set(core, node, &inL, 0);
     sk_param_set(core, node, &inR, 1);
@@ -1,5 +1,5 @@
 runtest () {
-    ../sndkit t/$1.lil
+    ../sndkit t/$1.lil > /dev/null
 
     if [ ! "$?" -eq 0 ]
     then
@@ -14,6 +14,22 @@ check () {
     printf "%s:%"$NSPACES"s\n" $1 $(runtest $1)
 }
 
+runbatch () {
+    ../sndkit -batch -j 4 -p t/$1_pre.lil t/$1.jobs > /dev/null
+
+    if [ ! "$?" -eq 0 ]
+    then
+        printf "fail"
+        return
+    fi
+    printf "ok"
+}
+
+checkbatch () {
+    NSPACES=$(expr 16 - ${#1})
+    printf "%s:%"$NSPACES"s\n" $1 $(runbatch $1)
+}
+
 check zero
 check sine
 check noise
@@ -75,3 +91,25 @@ check gtick
 check euclid
 check tractxyv
 check metrosync
+check threads
+check arena
+check blksize
+check optimize
+check reoptimize
+check fold
+check silence
+check cabclr
+check tailwake
+checkbatch batch
+check live
+check poly
+check events
+check swap
+check oversample
+check krate
+check oscbank
+check sosbank
+check modalbank
+check ensemble
+check tractk
+check vowelk